@@ -0,0 +1,40 @@
+#include "allocator.h"
+#include <stdlib.h> /* malloc */
+
+/**
+ * malloc wrapper
+ */
+void* allocator_libc_allocate(void* context, const size_t size);
+void* allocator_libc_allocate(void* context, const size_t size)
+{
+  (void)context;
+  return malloc(size);
+}
+
+/**
+ * realloc wrapper
+ */
+void* allocator_libc_reallocate(void* context, void* pointer, const size_t size);
+void* allocator_libc_reallocate(void* context, void* pointer, const size_t size)
+{
+  (void)context;
+  return realloc(pointer, size);
+}
+
+/**
+ * free wrapper
+ */
+void allocator_libc_release(void* context, void* pointer);
+void allocator_libc_release(void* context, void* pointer)
+{
+  (void)context;
+  free(pointer);
+}
+
+const allocator allocator_libc =
+{
+  allocator_libc_allocate,
+  allocator_libc_reallocate,
+  allocator_libc_release,
+  0
+};
@@ -0,0 +1,84 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  pluggable memory allocator interface
+*/
+
+#ifndef __VISUEM_ALLOCATOR_H__
+#define __VISUEM_ALLOCATOR_H__
+
+#include <stddef.h> /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief memory allocator interface
+   * containers take an allocator at creation time and route all of their memory 
+   * requests through it. a null allocator stands for allocator_libc.
+   */
+  typedef struct 
+  {
+    void*   (*allocate)(void* context, const size_t size);                    /* malloc equivalent */
+    void*   (*reallocate)(void* context, void* pointer, const size_t size);  /* realloc equivalent */
+    void    (*release)(void* context, void* pointer);                         /* free equivalent */
+    void*   context;                                                          /* user data passed to functions above */
+  } allocator;
+
+  /** 
+   * /brief allocator which uses malloc, realloc and free
+   */
+  extern const allocator allocator_libc;
+
+  /** 
+   * /brief resolves a null allocator to allocator_libc
+   */
+#define allocator_resolve(a) ((a) ? (a) : &allocator_libc)
+
+  /** 
+   * /brief allocates size bytes through an allocator
+   */
+#define allocator_allocate(a, size) ((a)->allocate((a)->context, (size)))
+
+  /** 
+   * /brief reallocates a block through an allocator
+   */
+#define allocator_reallocate(a, pointer, size) ((a)->reallocate((a)->context, (pointer), (size)))
+
+  /** 
+   * /brief releases a block through an allocator
+   */
+#define allocator_release(a, pointer) ((a)->release((a)->context, (pointer)))
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -1,83 +1,278 @@
-#include "array.h"
-#include <stdlib.h> /* malloc */
-#include <memory.h> /* memset */
-#include <string.h> /* memmove */
-
-array* array_alloc()
-{
-  array* new_array = (array*)malloc(sizeof(array));
-  memset(new_array, 0, sizeof(array));
-  return new_array;
-}
-
-void array_free(array* array_)
-{
-  if (array_->elements)
-  {
-    free(array_->elements);
-  }
-  free(array_);
-}
-
-generic* array_push(array* array_, void* data, const int tag) {
-  const int index = array_->usage;
-
-  if (index >= array_->capacity)
-  {
-    array_->capacity += array_->capacity ? array_->capacity : 8;
-    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));                                                                          
-  }
-  array_->elements[index].pointer = data;
-  array_->elements[index].tag = tag;
-  ++(array_->usage);
-  return &array_->elements[index];
-}
-
-generic* array_pop(array* array_)
-{ 
-  if (array_->usage > 0)
-  {
-    return &array_->elements[(array_->usage)--];
-  }
-  return NULL;
-}
-
-void array_insert(array* array_, const int index, void* data, const int tag) 
-{
-  if (index >= array_->usage)
-  {
-    array_push(array_, data, tag);
-    return;
-  }
-  if (array_->usage >= array_->capacity)
-  {
-    array_->capacity += array_->capacity?array_->capacity:8;
-    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));
-  }
-  memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(generic));
-  array_->elements[index].pointer = data;
-  array_->elements[index].tag = tag;
-  ++(array_->usage);
-}
-
-extern void array_remove(array* array_, const int index) 
-{
-  if (index >= array_->usage)
-  {
-    array_pop(array_);
-    return;
-  }
-  memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index) * sizeof(generic));                  
-  --(array_->usage);
-}
-
-extern void array_reset(array* array_)
-{
-  if (array_->elements) 
-  {
-    free(array_->elements);
-    array_->elements = 0;
-    array_->usage = 0;
-    array_->capacity = 0;
-  }
-}
+#include "array.h"
+#include <stdlib.h> /* malloc */
+#include <memory.h> /* memset */
+#include <string.h> /* memmove */
+
+array* array_alloc()
+{
+  return array_alloc_with(0);
+}
+
+array* array_alloc_with(const allocator* allocator_)
+{
+  array* new_array;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_array = (array*)allocator_allocate(allocator_, sizeof(array));
+  memset(new_array, 0, sizeof(array));
+  new_array->allocator_ = allocator_;
+  return new_array;
+}
+
+void array_free(array* array_)
+{
+  if (array_->elements)
+  {
+    allocator_release(array_->allocator_, array_->elements);
+  }
+  allocator_release(array_->allocator_, array_);
+}
+
+/**
+ * grows capacity of an array through 8, 16, 32.. ladder until it can hold required elements.
+ */
+void array_grow(array* array_, const int required);
+void array_grow(array* array_, const int required)
+{
+  int capacity = array_->capacity;
+
+  if (required <= capacity) return;
+  while (capacity < required)
+  {
+    capacity += capacity ? capacity : 8;
+  }
+  array_reserve(array_, capacity);
+}
+
+generic* array_push(array* array_, void* data, const int tag) {
+  const int index = array_->usage;
+
+  if (index >= array_->capacity)
+  {
+    array_grow(array_, index + 1);
+  }
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+  return &array_->elements[index];
+}
+
+generic* array_pop(array* array_)
+{ 
+  if (array_->usage > 0)
+  {
+    return &array_->elements[--(array_->usage)];
+  }
+  return NULL;
+}
+
+void array_insert(array* array_, const int index, void* data, const int tag) 
+{
+  if (index >= array_->usage)
+  {
+    array_push(array_, data, tag);
+    return;
+  }
+  if (array_->usage >= array_->capacity)
+  {
+    array_grow(array_, array_->usage + 1);
+  }
+  memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(generic));
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+}
+
+extern void array_remove(array* array_, const int index) 
+{
+  if (index >= array_->usage - 1)
+  {
+    array_pop(array_);
+    return;
+  }
+  memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index - 1) * sizeof(generic));                  
+  --(array_->usage);
+}
+
+extern void array_reset(array* array_)
+{
+  if (array_->elements) 
+  {
+    allocator_release(array_->allocator_, array_->elements);
+    array_->elements = 0;
+    array_->usage = 0;
+    array_->capacity = 0;
+  }
+}
+
+void array_reserve(array* array_, const int capacity)
+{
+  if (capacity > array_->capacity)
+  {
+    array_->capacity = capacity;
+    array_->elements = (generic*)allocator_reallocate(array_->allocator_, array_->elements, array_->capacity * sizeof(generic));
+  }
+}
+
+void array_shrink_to_fit(array* array_)
+{
+  if (array_->usage == array_->capacity) return;
+  if (array_->usage == 0)
+  {
+    array_reset(array_);
+    return;
+  }
+  array_->capacity = array_->usage;
+  array_->elements = (generic*)allocator_reallocate(array_->allocator_, array_->elements, array_->capacity * sizeof(generic));
+}
+
+generic* array_push_n(array* array_, const generic* elements, const int count)
+{
+  const int index = array_->usage;
+
+  if (count <= 0) return 0;
+  array_grow(array_, index + count);
+  memcpy(array_->elements + index, elements, count * sizeof(generic));
+  array_->usage += count;
+  return &array_->elements[index];
+}
+
+void array_insert_range(array* array_, const int index, const generic* elements, const int count)
+{
+  if (index >= array_->usage)
+  {
+    array_push_n(array_, elements, count);
+    return;
+  }
+  if (count <= 0) return;
+  array_grow(array_, array_->usage + count);
+  memmove(array_->elements + index + count, array_->elements + index, (array_->usage - index) * sizeof(generic));
+  memcpy(array_->elements + index, elements, count * sizeof(generic));
+  array_->usage += count;
+}
+
+void array_remove_range(array* array_, const int index, const int count)
+{
+  int last = index + count;
+
+  if (index >= array_->usage || count <= 0) return;
+  if (last >= array_->usage)
+  {
+    array_->usage = index;
+    return;
+  }
+  memmove(array_->elements + index, array_->elements + last, (array_->usage - last) * sizeof(generic));
+  array_->usage -= count;
+}
+
+void array_remove_swap(array* array_, const int index)
+{
+  if (index >= array_->usage) return;
+  array_->elements[index] = array_->elements[--(array_->usage)];
+}
+
+void array_clear(array* array_)
+{
+  array_->usage = 0;
+}
+
+/**
+ * grows a small array, moving its elements to the heap when they leave inline storage.
+ */
+void small_array_grow(small_array* array_);
+void small_array_grow(small_array* array_)
+{
+  generic* elements;
+
+  array_->capacity += array_->capacity;
+  if (array_->elements == array_->inline_elements)
+  {
+    elements = (generic*)allocator_allocate(array_->allocator_, array_->capacity * sizeof(generic));
+    memcpy(elements, array_->inline_elements, array_->usage * sizeof(generic));
+    array_->elements = elements;
+  }
+  else
+  {
+    array_->elements = (generic*)allocator_reallocate(array_->allocator_, array_->elements, array_->capacity * sizeof(generic));
+  }
+}
+
+void small_array_init(small_array* array_)
+{
+  small_array_init_with(array_, 0);
+}
+
+void small_array_init_with(small_array* array_, const allocator* allocator_)
+{
+  array_->allocator_ = allocator_resolve(allocator_);
+  array_->elements = array_->inline_elements;
+  array_->capacity = SMALL_ARRAY_INLINE_CAPACITY;
+  array_->usage = 0;
+}
+
+void small_array_release(small_array* array_)
+{
+  if (array_->elements != array_->inline_elements)
+  {
+    allocator_release(array_->allocator_, array_->elements);
+  }
+  array_->elements = array_->inline_elements;
+  array_->capacity = SMALL_ARRAY_INLINE_CAPACITY;
+  array_->usage = 0;
+}
+
+generic* small_array_push(small_array* array_, void* data, const int tag)
+{
+  const int index = array_->usage;
+
+  if (index >= array_->capacity)
+  {
+    small_array_grow(array_);
+  }
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+  return &array_->elements[index];
+}
+
+generic* small_array_pop(small_array* array_)
+{ 
+  if (array_->usage > 0)
+  {
+    return &array_->elements[--(array_->usage)];
+  }
+  return NULL;
+}
+
+void small_array_insert(small_array* array_, const int index, void* data, const int tag) 
+{
+  if (index >= array_->usage)
+  {
+    small_array_push(array_, data, tag);
+    return;
+  }
+  if (array_->usage >= array_->capacity)
+  {
+    small_array_grow(array_);
+  }
+  memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(generic));
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+}
+
+void small_array_remove(small_array* array_, const int index) 
+{
+  if (index >= array_->usage - 1)
+  {
+    small_array_pop(array_);
+    return;
+  }
+  memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index - 1) * sizeof(generic));                  
+  --(array_->usage);
+}
+
+void small_array_reset(small_array* array_)
+{
+  small_array_release(array_);
+}
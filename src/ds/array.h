@@ -1,95 +1,206 @@
-/*
-
-  The MIT License (MIT)
-
-  Copyright (c) 2015 VISUEM LTD
-
-  Permission is hereby granted, free of charge, to any person obtaining a copy
-  of this software and associated documentation files (the "Software"), to deal
-  in the Software without restriction, including without limitation the rights
-  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-  copies of the Software, and to permit persons to whom the Software is
-  furnished to do so, subject to the following conditions:
-
-  The above copyright notice and this permission notice shall be included in all
-  copies or substantial portions of the Software.
-
-  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-  SOFTWARE.
-
-*/
-
-/*
-*  author:    noyan gunday
-*  date:      dec 24th, 2006
-*  abstract:  type independent dynamic array
-*/
-
-#ifndef __VISUEM_ARRAY_H__
-#define __VISUEM_ARRAY_H__
-
-#include "generic.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-  /** 
-   * /brief array structure
-   */      
-  typedef struct 
-  {   
-    generic*  elements;    /* elements of array */     
-    int       capacity;    /* current capacity of array */                    
-    int       usage;       /* current usage of array */                      
-  } array; 
-
-  /**
-   * /brief creates an empty array 
-   * /return an empty array instance. array elements aren't allocated yet. you need
-   *         to push or insert an element to allocate elements. (lazy alloc.)
-   */
-  extern array* array_alloc();    
-
-  /** 
-   * /brief deletes an array 
-   * not responsible for deallocation of data within nodes
-   */      
-  extern void array_free(array* array_);
-
-  /** 
-   * /brief pushes an element to the end of the array.
-   */        
-  extern generic* array_push(array* array_, void* data, const int tag);      
-
-  /**
-   * /brief pops back the element at the end of the array.
-   */  
-  extern generic* array_pop(array* array_);
-
-  /** 
-   * /brief inserts an element to a given index of the array.
-   */    
-  extern void array_insert(array* array_, const int index, void* data, const int tag);
-
-  /** 
-   * /brief removes an element at a given index of the array.
-   */              
-  extern void array_remove(array* array_, const int index);
-
-  /** 
-   * /brief clears all elements of the array.
-   * not responsible for deallocation of data within nodes
-   */
-  extern void array_reset(array* array_);
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      dec 24th, 2006
+*  abstract:  type independent dynamic array
+*/
+
+#ifndef __VISUEM_ARRAY_H__
+#define __VISUEM_ARRAY_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief array structure
+   */      
+  typedef struct 
+  {   
+    generic*  elements;    /* elements of array */     
+    int       capacity;    /* current capacity of array */                    
+    int       usage;       /* current usage of array */                      
+    const allocator* allocator_;  /* allocator of array and its elements */
+  } array; 
+
+  /**
+   * /brief number of elements a small array keeps inside its own structure
+   */
+#define SMALL_ARRAY_INLINE_CAPACITY 8
+
+  /** 
+   * /brief array structure with inline storage for first few elements.
+   * elements points to inline_elements until usage exceeds SMALL_ARRAY_INLINE_CAPACITY,
+   * then elements are moved to the heap. meant to be embedded into other structures, 
+   * it refers to itself so it must not be copied by value.
+   */      
+  typedef struct 
+  {   
+    generic*  elements;                                       /* elements of array */     
+    int       capacity;                                       /* current capacity of array */                    
+    int       usage;                                          /* current usage of array */                      
+    const allocator* allocator_;                              /* allocator of heap storage */
+    generic   inline_elements[SMALL_ARRAY_INLINE_CAPACITY];   /* inline storage */
+  } small_array; 
+
+  /**
+   * /brief creates an empty array 
+   * /return an empty array instance. array elements aren't allocated yet. you need
+   *         to push or insert an element to allocate elements. (lazy alloc.)
+   */
+  extern array* array_alloc();    
+
+  /**
+   * /brief creates an empty array which gets its memory from a given allocator
+   */
+  extern array* array_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes an array 
+   * not responsible for deallocation of data within nodes
+   */      
+  extern void array_free(array* array_);
+
+  /** 
+   * /brief pushes an element to the end of the array.
+   */        
+  extern generic* array_push(array* array_, void* data, const int tag);      
+
+  /**
+   * /brief pops back the element at the end of the array.
+   */  
+  extern generic* array_pop(array* array_);
+
+  /** 
+   * /brief inserts an element to a given index of the array.
+   */    
+  extern void array_insert(array* array_, const int index, void* data, const int tag);
+
+  /** 
+   * /brief removes an element at a given index of the array.
+   */              
+  extern void array_remove(array* array_, const int index);
+
+  /** 
+   * /brief clears all elements of the array.
+   * not responsible for deallocation of data within nodes
+   */
+  extern void array_reset(array* array_);
+
+  /** 
+   * /brief clears all elements of the array but keeps its capacity.
+   * not responsible for deallocation of data within nodes
+   */
+  extern void array_clear(array* array_);
+
+  /** 
+   * /brief makes sure array can hold given number of elements without reallocation.
+   */
+  extern void array_reserve(array* array_, const int capacity);
+
+  /** 
+   * /brief releases unused capacity of the array.
+   */
+  extern void array_shrink_to_fit(array* array_);
+
+  /** 
+   * /brief pushes count elements to the end of the array.
+   * elements must not point into the array itself, growing may release them.
+   * /return pointer to the first pushed element.
+   */
+  extern generic* array_push_n(array* array_, const generic* elements, const int count);
+
+  /** 
+   * /brief inserts count elements to a given index of the array with a single move.
+   * elements must not point into the array itself, growing may release them and the
+   * move may shift them before they are copied.
+   */
+  extern void array_insert_range(array* array_, const int index, const generic* elements, const int count);
+
+  /** 
+   * /brief removes count elements starting from a given index of the array with a single move.
+   */
+  extern void array_remove_range(array* array_, const int index, const int count);
+
+  /** 
+   * /brief removes an element at a given index by moving the last element into its place.
+   * doesn't preserve order of elements.
+   */
+  extern void array_remove_swap(array* array_, const int index);
+
+  /** 
+   * /brief initializes a small array in place. 
+   * no allocation is made until usage exceeds SMALL_ARRAY_INLINE_CAPACITY.
+   */
+  extern void small_array_init(small_array* array_);
+
+  /** 
+   * /brief initializes a small array in place which spills to a given allocator.
+   */
+  extern void small_array_init_with(small_array* array_, const allocator* allocator_);
+
+  /** 
+   * /brief releases heap storage of a small array if it has any.
+   * not responsible for deallocation of data within nodes
+   */
+  extern void small_array_release(small_array* array_);
+
+  /** 
+   * /brief pushes an element to the end of the small array.
+   */        
+  extern generic* small_array_push(small_array* array_, void* data, const int tag);      
+
+  /**
+   * /brief pops back the element at the end of the small array.
+   */  
+  extern generic* small_array_pop(small_array* array_);
+
+  /** 
+   * /brief inserts an element to a given index of the small array.
+   */    
+  extern void small_array_insert(small_array* array_, const int index, void* data, const int tag);
+
+  /** 
+   * /brief removes an element at a given index of the small array.
+   */              
+  extern void small_array_remove(small_array* array_, const int index);
+
+  /** 
+   * /brief clears all elements of the small array and returns it to inline storage.
+   * not responsible for deallocation of data within nodes
+   */
+  extern void small_array_reset(small_array* array_);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
 #endif
\ No newline at end of file
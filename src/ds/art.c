@@ -0,0 +1,528 @@
+#include "art.h"
+#include <string.h> /* strlen */
+#include <memory.h> /* memset */
+#include <stddef.h> /* offsetof */
+#include <stdint.h> /* uintptr_t */
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * inner node layouts
+ */
+typedef struct
+{
+  art_node              base;
+  unsigned char         keys[4];
+  art_node*             children[4];
+} art_node4;
+
+typedef struct
+{
+  art_node              base;
+  unsigned char         keys[16];
+  art_node*             children[16];
+} art_node16;
+
+typedef struct
+{
+  art_node              base;
+  unsigned char         index[256];     /* child slot + 1 of each byte, 0 if byte has no child */
+  art_node*             children[48];
+} art_node48;
+
+typedef struct
+{
+  art_node              base;
+  art_node*             children[256];
+} art_node256;
+
+/**
+ * leaves are stored in child slots with their lowest pointer bit set
+ */
+#define art_is_leaf(n) (((uintptr_t)(n)) & 1)
+#define art_leaf_of(n) ((art_leaf*)((uintptr_t)(n) & ~(uintptr_t)1))
+#define art_leaf_tag(l) ((art_node*)((uintptr_t)(l) | 1))
+
+/**
+ * smaller of two values
+ */
+#define art_min(a, b) ((a) < (b) ? (a) : (b))
+
+/**
+ * creates an inner node of given type
+ */
+art_node* art_node_create(art* tree, const art_node_type type);
+art_node* art_node_create(art* tree, const art_node_type type)
+{
+  static const size_t sizes[] = { sizeof(art_node4), sizeof(art_node16), sizeof(art_node48), sizeof(art_node256) };
+  art_node* node = (art_node*)allocator_allocate(tree->allocator_, sizes[type]);
+
+  memset(node, 0, sizes[type]);
+  node->type = (unsigned char)type;
+  return node;
+}
+
+/**
+ * creates a leaf for a key. length includes terminating null.
+ */
+art_leaf* art_leaf_create(art* tree, const char* key, const int length, void* data, const int tag);
+art_leaf* art_leaf_create(art* tree, const char* key, const int length, void* data, const int tag)
+{
+  art_leaf* leaf = (art_leaf*)allocator_allocate(tree->allocator_, offsetof(art_leaf, key) + length);
+
+  leaf->value.pointer = data;
+  leaf->value.tag = tag;
+  leaf->length = length;
+  memcpy(leaf->key, key, length);
+  return leaf;
+}
+
+/**
+ * deletes a node with its children
+ */
+void art_node_destroy(art* tree, art_node* node);
+void art_node_destroy(art* tree, art_node* node)
+{
+  int loop;
+
+  if (art_is_leaf(node))
+  {
+    allocator_release(tree->allocator_, art_leaf_of(node));
+    return;
+  }
+  switch (node->type)
+  {
+  case art_node_4:
+    for (loop = 0; loop < node->count; loop++) art_node_destroy(tree, ((art_node4*)node)->children[loop]);
+    break;
+  case art_node_16:
+    for (loop = 0; loop < node->count; loop++) art_node_destroy(tree, ((art_node16*)node)->children[loop]);
+    break;
+  case art_node_48:
+    for (loop = 0; loop < 48; loop++) if (((art_node48*)node)->children[loop]) art_node_destroy(tree, ((art_node48*)node)->children[loop]);
+    break;
+  case art_node_256:
+    for (loop = 0; loop < 256; loop++) if (((art_node256*)node)->children[loop]) art_node_destroy(tree, ((art_node256*)node)->children[loop]);
+    break;
+  }
+  allocator_release(tree->allocator_, node);
+}
+
+/**
+ * finds child slot of a byte, returns a null pointer if there is no such child
+ */
+art_node** art_find_child(art_node* node, const unsigned char byte);
+art_node** art_find_child(art_node* node, const unsigned char byte)
+{
+  art_node4* node4;
+  art_node16* node16;
+  art_node48* node48;
+  art_node256* node256;
+  int loop;
+#ifdef __SSE2__
+  unsigned int mask;
+#endif
+
+  switch (node->type)
+  {
+  case art_node_4:
+    node4 = (art_node4*)node;
+    for (loop = 0; loop < node->count; loop++)
+    {
+      if (node4->keys[loop] == byte) return &node4->children[loop];
+    }
+    break;
+  case art_node_16:
+    node16 = (art_node16*)node;
+#ifdef __SSE2__
+    mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)byte), _mm_loadu_si128((const __m128i*)node16->keys)));
+    mask &= (1u << node->count) - 1;
+    if (mask) return &node16->children[__builtin_ctz(mask)];
+#else
+    for (loop = 0; loop < node->count; loop++)
+    {
+      if (node16->keys[loop] == byte) return &node16->children[loop];
+    }
+#endif
+    break;
+  case art_node_48:
+    node48 = (art_node48*)node;
+    if (node48->index[byte]) return &node48->children[node48->index[byte] - 1];
+    break;
+  case art_node_256:
+    node256 = (art_node256*)node;
+    if (node256->children[byte]) return &node256->children[byte];
+    break;
+  }
+  return 0;
+}
+
+/**
+ * leaf with the smallest key below a node
+ */
+art_leaf* art_minimum(art_node* node);
+art_leaf* art_minimum(art_node* node)
+{
+  int loop;
+
+  while (!art_is_leaf(node))
+  {
+    switch (node->type)
+    {
+    case art_node_4:
+      node = ((art_node4*)node)->children[0];
+      break;
+    case art_node_16:
+      node = ((art_node16*)node)->children[0];
+      break;
+    case art_node_48:
+      for (loop = 0; !((art_node48*)node)->index[loop]; loop++);
+      node = ((art_node48*)node)->children[((art_node48*)node)->index[loop] - 1];
+      break;
+    default:
+      for (loop = 0; !((art_node256*)node)->children[loop]; loop++);
+      node = ((art_node256*)node)->children[loop];
+      break;
+    }
+  }
+  return art_leaf_of(node);
+}
+
+/**
+ * number of leading bytes of the compressed path of a node matching key from depth on.
+ * path bytes which aren't stored in the node are compared against a leaf below it.
+ */
+int art_prefix_mismatch(art_node* node, const char* key, const int length, const int depth);
+int art_prefix_mismatch(art_node* node, const char* key, const int length, const int depth)
+{
+  int limit = art_min(art_min(ART_MAX_PREFIX, node->prefix_length), length - depth);
+  int index;
+  art_leaf* leaf;
+
+  for (index = 0; index < limit; index++)
+  {
+    if (node->prefix[index] != (unsigned char)key[depth + index]) return index;
+  }
+  if (node->prefix_length > ART_MAX_PREFIX)
+  {
+    leaf = art_minimum(node);
+    limit = art_min(art_min(leaf->length, length) - depth, node->prefix_length);
+    for (; index < limit; index++)
+    {
+      if (leaf->key[depth + index] != key[depth + index]) return index;
+    }
+  }
+  return index;
+}
+
+/**
+ * checks stored bytes of compressed path of a node against key from depth on
+ * returns nonzero on a mismatch.
+ */
+int art_prefix_mismatch_stored(const art_node* node, const char* key, const int length, const int depth);
+int art_prefix_mismatch_stored(const art_node* node, const char* key, const int length, const int depth)
+{
+  const int stored = art_min(ART_MAX_PREFIX, node->prefix_length);
+  int index;
+
+  if (stored > length - depth) return 1;
+  for (index = 0; index < stored; index++)
+  {
+    if (node->prefix[index] != (unsigned char)key[depth + index]) return 1;
+  }
+  return 0;
+}
+
+/**
+ * copies compressed path of a node to another
+ */
+void art_copy_header(art_node* target, const art_node* source);
+void art_copy_header(art_node* target, const art_node* source)
+{
+  target->count = source->count;
+  target->prefix_length = source->prefix_length;
+  memcpy(target->prefix, source->prefix, art_min(ART_MAX_PREFIX, source->prefix_length));
+}
+
+/**
+ * adds a child to a node, growing node into next type when it is full. reference is
+ * the slot which points to node.
+ */
+void art_add_child(art* tree, art_node* node, art_node** reference, const unsigned char byte, art_node* child);
+void art_add_child(art* tree, art_node* node, art_node** reference, const unsigned char byte, art_node* child)
+{
+  art_node4* node4;
+  art_node16* node16;
+  art_node48* node48;
+  art_node* grown;
+  int index;
+  int loop;
+
+  switch (node->type)
+  {
+  case art_node_4:
+    node4 = (art_node4*)node;
+    if (node->count < 4)
+    {
+      for (index = 0; index < node->count && node4->keys[index] < byte; index++);
+      memmove(node4->keys + index + 1, node4->keys + index, node->count - index);
+      memmove(node4->children + index + 1, node4->children + index, (node->count - index) * sizeof(art_node*));
+      node4->keys[index] = byte;
+      node4->children[index] = child;
+      ++(node->count);
+      return;
+    }
+    grown = art_node_create(tree, art_node_16);
+    art_copy_header(grown, node);
+    memcpy(((art_node16*)grown)->keys, node4->keys, 4);
+    memcpy(((art_node16*)grown)->children, node4->children, 4 * sizeof(art_node*));
+    break;
+  case art_node_16:
+    node16 = (art_node16*)node;
+    if (node->count < 16)
+    {
+      for (index = 0; index < node->count && node16->keys[index] < byte; index++);
+      memmove(node16->keys + index + 1, node16->keys + index, node->count - index);
+      memmove(node16->children + index + 1, node16->children + index, (node->count - index) * sizeof(art_node*));
+      node16->keys[index] = byte;
+      node16->children[index] = child;
+      ++(node->count);
+      return;
+    }
+    grown = art_node_create(tree, art_node_48);
+    art_copy_header(grown, node);
+    memcpy(((art_node48*)grown)->children, node16->children, 16 * sizeof(art_node*));
+    for (loop = 0; loop < 16; loop++)
+    {
+      ((art_node48*)grown)->index[node16->keys[loop]] = (unsigned char)(loop + 1);
+    }
+    break;
+  case art_node_48:
+    node48 = (art_node48*)node;
+    if (node->count < 48)
+    {
+      for (index = 0; node48->children[index]; index++);
+      node48->children[index] = child;
+      node48->index[byte] = (unsigned char)(index + 1);
+      ++(node->count);
+      return;
+    }
+    grown = art_node_create(tree, art_node_256);
+    art_copy_header(grown, node);
+    for (loop = 0; loop < 256; loop++)
+    {
+      if (node48->index[loop]) ((art_node256*)grown)->children[loop] = node48->children[node48->index[loop] - 1];
+    }
+    break;
+  default:
+    ((art_node256*)node)->children[byte] = child;
+    ++(node->count);
+    return;
+  }
+  *reference = grown;
+  allocator_release(tree->allocator_, node);
+  art_add_child(tree, grown, reference, byte, child);
+}
+
+/**
+ * inserts a key into the subtree referenced by a slot
+ * returns 0 if key already exists.
+ */
+int art_insert_at(art* tree, art_node** reference, const char* key, const int length, int depth, void* data, const int tag);
+int art_insert_at(art* tree, art_node** reference, const char* key, const int length, int depth, void* data, const int tag)
+{
+  art_node* node = *reference;
+  art_node* split;
+  art_leaf* leaf;
+  art_leaf* new_leaf;
+  art_node** child;
+  int common;
+
+  if (!node)
+  {
+    *reference = art_leaf_tag(art_leaf_create(tree, key, length, data, tag));
+    return 1;
+  }
+  if (art_is_leaf(node))
+  {
+    leaf = art_leaf_of(node);
+    if (leaf->length == length && memcmp(leaf->key, key, length) == 0) return 0;
+    /* lazy expansion, two leaves get a node which holds their common path */
+    new_leaf = art_leaf_create(tree, key, length, data, tag);
+    for (common = 0; leaf->key[depth + common] == key[depth + common]; common++);
+    split = art_node_create(tree, art_node_4);
+    split->prefix_length = common;
+    memcpy(split->prefix, key + depth, art_min(ART_MAX_PREFIX, common));
+    *reference = split;
+    art_add_child(tree, split, reference, (unsigned char)leaf->key[depth + common], node);
+    art_add_child(tree, split, reference, (unsigned char)key[depth + common], art_leaf_tag(new_leaf));
+    return 1;
+  }
+  if (node->prefix_length)
+  {
+    common = art_prefix_mismatch(node, key, length, depth);
+    if (common < node->prefix_length)
+    {
+      /* key leaves compressed path, path is split at the mismatch */
+      split = art_node_create(tree, art_node_4);
+      split->prefix_length = common;
+      memcpy(split->prefix, node->prefix, art_min(ART_MAX_PREFIX, common));
+      *reference = split;
+      if (node->prefix_length <= ART_MAX_PREFIX)
+      {
+        art_add_child(tree, split, reference, node->prefix[common], node);
+        node->prefix_length -= common + 1;
+        memmove(node->prefix, node->prefix + common + 1, art_min(ART_MAX_PREFIX, node->prefix_length));
+      }
+      else
+      {
+        node->prefix_length -= common + 1;
+        leaf = art_minimum(node);
+        art_add_child(tree, split, reference, (unsigned char)leaf->key[depth + common], node);
+        memcpy(node->prefix, leaf->key + depth + common + 1, art_min(ART_MAX_PREFIX, node->prefix_length));
+      }
+      new_leaf = art_leaf_create(tree, key, length, data, tag);
+      art_add_child(tree, split, reference, (unsigned char)key[depth + common], art_leaf_tag(new_leaf));
+      return 1;
+    }
+    depth += node->prefix_length;
+  }
+  child = art_find_child(node, (unsigned char)key[depth]);
+  if (child) return art_insert_at(tree, child, key, length, depth + 1, data, tag);
+  new_leaf = art_leaf_create(tree, key, length, data, tag);
+  art_add_child(tree, node, reference, (unsigned char)key[depth], art_leaf_tag(new_leaf));
+  return 1;
+}
+
+/**
+ * visits all leaves below a node in key order
+ */
+int art_iterate(art_node* node, art_visitor visitor, void* context);
+int art_iterate(art_node* node, art_visitor visitor, void* context)
+{
+  art_leaf* leaf;
+  int result = 0;
+  int loop;
+
+  if (art_is_leaf(node))
+  {
+    leaf = art_leaf_of(node);
+    return visitor(context, leaf->key, &leaf->value);
+  }
+  switch (node->type)
+  {
+  case art_node_4:
+    for (loop = 0; loop < node->count && !result; loop++) result = art_iterate(((art_node4*)node)->children[loop], visitor, context);
+    break;
+  case art_node_16:
+    for (loop = 0; loop < node->count && !result; loop++) result = art_iterate(((art_node16*)node)->children[loop], visitor, context);
+    break;
+  case art_node_48:
+    for (loop = 0; loop < 256 && !result; loop++)
+    {
+      if (((art_node48*)node)->index[loop]) result = art_iterate(((art_node48*)node)->children[((art_node48*)node)->index[loop] - 1], visitor, context);
+    }
+    break;
+  default:
+    for (loop = 0; loop < 256 && !result; loop++)
+    {
+      if (((art_node256*)node)->children[loop]) result = art_iterate(((art_node256*)node)->children[loop], visitor, context);
+    }
+    break;
+  }
+  return result;
+}
+
+art* art_alloc()
+{
+  return art_alloc_with(0);
+}
+
+art* art_alloc_with(const allocator* allocator_)
+{
+  art* new_tree;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_tree = (art*)allocator_allocate(allocator_, sizeof(art));
+  memset(new_tree, 0, sizeof(art));
+  new_tree->allocator_ = allocator_;
+  return new_tree;
+}
+
+void art_free(art* tree)
+{
+  if (tree->root) art_node_destroy(tree, tree->root);
+  allocator_release(tree->allocator_, tree);
+}
+
+void art_insert(art* tree, const char* key, void* data, const int tag)
+{
+  /* terminating null is a part of the key, so no key is a prefix of another */
+  if (art_insert_at(tree, &tree->root, key, (int)strlen(key) + 1, 0, data, tag)) ++(tree->size);
+}
+
+generic* art_search(art* tree, const char* key)
+{
+  const int length = (int)strlen(key) + 1;
+  art_node* node = tree->root;
+  art_node** child;
+  art_leaf* leaf;
+  int depth = 0;
+
+  while (node)
+  {
+    if (art_is_leaf(node))
+    {
+      leaf = art_leaf_of(node);
+      if (leaf->length == length && memcmp(leaf->key, key, length) == 0) return &leaf->value;
+      return 0;
+    }
+    if (node->prefix_length)
+    {
+      /* only stored bytes are checked, leaf comparison at the end covers the rest */
+      if (art_prefix_mismatch_stored(node, key, length, depth)) return 0;
+      depth += node->prefix_length;
+      if (depth >= length) return 0;
+    }
+    child = art_find_child(node, (unsigned char)key[depth]);
+    node = child ? *child : 0;
+    ++depth;
+  }
+  return 0;
+}
+
+int art_iterate_prefix(art* tree, const char* prefix, art_visitor visitor, void* context)
+{
+  const int length = (int)strlen(prefix);
+  art_node* node = tree->root;
+  art_node** child;
+  art_leaf* leaf;
+  int depth = 0;
+  int common;
+
+  while (node)
+  {
+    if (art_is_leaf(node))
+    {
+      leaf = art_leaf_of(node);
+      if (leaf->length > length && memcmp(leaf->key, prefix, length) == 0) return visitor(context, leaf->key, &leaf->value);
+      return 0;
+    }
+    if (depth == length) return art_iterate(node, visitor, context);
+    if (node->prefix_length)
+    {
+      common = art_prefix_mismatch(node, prefix, length, depth);
+      /* prefix ends within compressed path, whole subtree matches */
+      if (depth + common >= length) return art_iterate(node, visitor, context);
+      if (common < node->prefix_length) return 0;
+      depth += node->prefix_length;
+      if (depth == length) return art_iterate(node, visitor, context);
+    }
+    child = art_find_child(node, (unsigned char)prefix[depth]);
+    node = child ? *child : 0;
+    ++depth;
+  }
+  return 0;
+}
@@ -0,0 +1,137 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  adaptive radix tree with string keys
+*/
+
+#ifndef __VISUEM_ART_H__
+#define __VISUEM_ART_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief number of compressed path bytes stored in an inner node
+   */
+#define ART_MAX_PREFIX 10
+
+  /**
+   * /brief inner node types
+   */
+  typedef enum 
+  {
+    art_node_4,                   /* up to 4 children, sorted keys */
+    art_node_16,                  /* up to 16 children, sorted keys */
+    art_node_48,                  /* up to 48 children, indexed by a 256 byte map */
+    art_node_256                  /* direct array of 256 children */
+  } art_node_type;
+
+  /** 
+   * /brief common part of inner nodes
+   * nodes with a single path below them are collapsed into the prefix of the next node.
+   * only ART_MAX_PREFIX bytes of it are stored, the rest is checked against a leaf.
+   */
+  typedef struct 
+  {
+    unsigned char         type;                       /* art_node_type */
+    unsigned char         prefix[ART_MAX_PREFIX];     /* first bytes of compressed path */
+    unsigned short        count;                      /* number of children */
+    int                   prefix_length;              /* length of compressed path */
+  } art_node;
+
+  /** 
+   * /brief leaf. leaves are created lazily, a single key never gets inner nodes of its own.
+   */
+  typedef struct 
+  {
+    generic               value;
+    int                   length;                     /* key length with terminating null */
+    char                  key[1];                     /* key, extends beyond the end of the structure */
+  } art_leaf;
+
+  /** 
+   * /brief adaptive radix tree
+   */
+  typedef struct 
+  {
+    art_node*             root;                       /* root node, may be a tagged leaf */
+    int                   size;
+    const allocator*      allocator_;
+  } art;
+
+  /** 
+   * /brief callback of prefix iteration, returning non zero stops iteration
+   */
+  typedef int (*art_visitor)(void* context, const char* key, generic* value);
+
+  /** 
+   * /brief allocates an adaptive radix tree
+   */
+  extern art* art_alloc();
+
+  /** 
+   * /brief allocates an adaptive radix tree which gets its memory from a given allocator
+   */
+  extern art* art_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes an adaptive radix tree
+   * not responsible for deallocation of data within nodes
+   */    
+  extern void art_free(art* tree);
+
+  /** 
+   * /brief inserts a key-value pair into tree. 
+   * key is copied. nothing is changed if key already exists.
+   */
+  extern void art_insert(art* tree, const char* key, void* data, const int tag);
+
+  /** 
+   * /brief searches tree with a specific key 
+   *
+   * /return pointer to element related with given key.
+   *         a null pointer if key is not found.
+   */
+  extern generic* art_search(art* tree, const char* key);
+
+  /** 
+   * /brief visits every key starting with a given prefix in key order
+   * /return value returned by the visitor which stopped iteration, 0 if none did.
+   */
+  extern int art_iterate_prefix(art* tree, const char* prefix, art_visitor visitor, void* context);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
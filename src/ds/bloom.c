@@ -0,0 +1,99 @@
+#include "bloom.h"
+#include "hash.h"
+#include <memory.h> /* memset */
+#include <stdint.h> /* uintptr_t */
+
+/**
+ * size of a block in bytes
+ */
+#define BLOOM_BLOCK_SIZE (BLOOM_BLOCK_WORDS * sizeof(unsigned long long))
+
+/**
+ * block of a hash. high bits select the block, low bits the bits within it.
+ */
+#define bloom_block_of(f, h) ((f)->blocks + ((h) >> 32 & (unsigned long long)((f)->block_count - 1)) * BLOOM_BLOCK_WORDS)
+
+/**
+ * remixes low bits of a hash and picks one bit per word out of 6-bit slices of it
+ */
+unsigned long long bloom_bits(const unsigned long long hash);
+unsigned long long bloom_bits(const unsigned long long hash)
+{
+  unsigned long long bits = hash ^ (hash >> 31);
+
+  bits *= 0xbf58476d1ce4e5b9ULL;
+  return bits ^ (bits >> 27);
+}
+
+bloom* bloom_alloc(const int capacity, const int bits_per_key)
+{
+  return bloom_alloc_with(0, capacity, bits_per_key);
+}
+
+bloom* bloom_alloc_with(const allocator* allocator_, const int capacity, const int bits_per_key)
+{
+  bloom* new_filter;
+  long long bits = (long long)(capacity > 0 ? capacity : 1) * (bits_per_key > 0 ? bits_per_key : 1);
+
+  allocator_ = allocator_resolve(allocator_);
+  new_filter = (bloom*)allocator_allocate(allocator_, sizeof(bloom));
+  new_filter->allocator_ = allocator_;
+  new_filter->capacity = capacity;
+  new_filter->bits_per_key = bits_per_key;
+  new_filter->block_count = 1;
+  while ((long long)new_filter->block_count * BLOOM_BLOCK_WORDS * 64 < bits) new_filter->block_count <<= 1;
+
+  /* one spare block to align to a cache line */
+  new_filter->memory = allocator_allocate(allocator_, (new_filter->block_count + 1) * BLOOM_BLOCK_SIZE);
+  new_filter->blocks = (unsigned long long*)(((uintptr_t)new_filter->memory + BLOOM_BLOCK_SIZE - 1) & ~(uintptr_t)(BLOOM_BLOCK_SIZE - 1));
+  bloom_clear(new_filter);
+  return new_filter;
+}
+
+void bloom_free(bloom* filter)
+{
+  allocator_release(filter->allocator_, filter->memory);
+  allocator_release(filter->allocator_, filter);
+}
+
+void bloom_clear(bloom* filter)
+{
+  memset(filter->blocks, 0, filter->block_count * BLOOM_BLOCK_SIZE);
+}
+
+void bloom_add_hash(bloom* filter, const unsigned long long hash)
+{
+  unsigned long long* block = bloom_block_of(filter, hash);
+  unsigned long long bits = bloom_bits(hash);
+  int loop;
+
+  for (loop = 0; loop < BLOOM_BLOCK_WORDS; loop++)
+  {
+    block[loop] |= 1ULL << (bits >> (loop * 6) & 63);
+  }
+}
+
+int bloom_contains_hash(const bloom* filter, const unsigned long long hash)
+{
+  const unsigned long long* block = bloom_block_of(filter, hash);
+  unsigned long long bits = bloom_bits(hash);
+  unsigned long long missing = 0;
+  int loop;
+
+  /* no early exit, all words are on the same cache line anyway */
+  for (loop = 0; loop < BLOOM_BLOCK_WORDS; loop++)
+  {
+    missing |= ~block[loop] & (1ULL << (bits >> (loop * 6) & 63));
+  }
+  return missing == 0;
+}
+
+void bloom_add(bloom* filter, const char* key)
+{
+  bloom_add_hash(filter, hash_string(key));
+}
+
+int bloom_contains(const bloom* filter, const char* key)
+{
+  return bloom_contains_hash(filter, hash_string(key));
+}
@@ -0,0 +1,111 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  blocked bloom filter
+*/
+
+#ifndef __VISUEM_BLOOM_H__
+#define __VISUEM_BLOOM_H__
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief number of 64-bit words in a filter block. a block is a single cache line.
+   */
+#define BLOOM_BLOCK_WORDS 8
+
+  /** 
+   * /brief blocked bloom filter
+   * a key selects a single block and sets one bit in each word of it, so a query 
+   * touches one cache line. a filter answers "maybe present" or "surely absent", it 
+   * has no false negatives. keys can't be removed.
+   */
+  typedef struct 
+  {
+    unsigned long long*   blocks;             /* cache line aligned blocks */
+    void*                 memory;             /* allocation blocks are carved from */
+    int                   block_count;        /* number of blocks, a power of 2 */
+    int                   capacity;           /* number of keys filter is sized for */
+    int                   bits_per_key;
+    const allocator*      allocator_;
+  } bloom;
+
+  /** 
+   * /brief allocates a filter for a number of keys with given bits per key.
+   * 10 bits per key gives roughly 1% false positives.
+   */
+  extern bloom* bloom_alloc(const int capacity, const int bits_per_key);
+
+  /** 
+   * /brief allocates a filter which gets its memory from a given allocator
+   */
+  extern bloom* bloom_alloc_with(const allocator* allocator_, const int capacity, const int bits_per_key);
+
+  /** 
+   * /brief deletes a filter
+   */
+  extern void bloom_free(bloom* filter);
+
+  /** 
+   * /brief empties a filter
+   */
+  extern void bloom_clear(bloom* filter);
+
+  /** 
+   * /brief adds a key given by its 64-bit hash to filter
+   */
+  extern void bloom_add_hash(bloom* filter, const unsigned long long hash);
+
+  /** 
+   * /brief checks a key given by its 64-bit hash against filter
+   * /return 0 if key was surely never added, 1 if it may have been.
+   */
+  extern int bloom_contains_hash(const bloom* filter, const unsigned long long hash);
+
+  /** 
+   * /brief adds a string key to filter
+   */
+  extern void bloom_add(bloom* filter, const char* key);
+
+  /** 
+   * /brief checks a string key against filter
+   * /return 0 if key was surely never added, 1 if it may have been.
+   */
+  extern int bloom_contains(const bloom* filter, const char* key);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
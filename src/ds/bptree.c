@@ -0,0 +1,508 @@
+#include "bptree.h"
+#include <string.h> /* strcmp */
+#include <memory.h> /* memset */
+
+/**
+ * minimum number of keys in a node other than root. an internal node gives one of its
+ * keys to its parent when it splits, so it is allowed one key less than a leaf.
+ */
+#define bpnode_minimum(n) ((n)->leaf ? BPTREE_ORDER / 2 : BPTREE_ORDER / 2 - 1)
+
+/**
+ * node casts
+ */
+#define bpnode_as_leaf(n) ((bpleaf*)(n))
+#define bpnode_as_internal(n) ((bpinternal*)(n))
+
+/**
+ * packs first 8 bytes of a key into an integer in big-endian order
+ */
+unsigned long long bptree_key_prefix(const char* key);
+unsigned long long bptree_key_prefix(const char* key)
+{
+  unsigned long long prefix = 0;
+  int loop;
+
+  for (loop = 0; loop < 8 && key[loop]; loop++)
+  {
+    prefix |= (unsigned long long)(unsigned char)key[loop] << (56 - loop * 8);
+  }
+  return prefix;
+}
+
+/**
+ * compares a key with key i of a node
+ */
+int bpnode_compare(const bpnode* node, const int i, const char* key, const unsigned long long prefix);
+int bpnode_compare(const bpnode* node, const int i, const char* key, const unsigned long long prefix)
+{
+  if (prefix != node->prefixes[i]) return prefix < node->prefixes[i] ? -1 : 1;
+  return strcmp(key, node->keys[i]);
+}
+
+/**
+ * index of the first key of a node which is not less than a given key. found is set if they are equal.
+ */
+int bpnode_lower_bound(const bpnode* node, const char* key, const unsigned long long prefix, int* found);
+int bpnode_lower_bound(const bpnode* node, const char* key, const unsigned long long prefix, int* found)
+{
+  int low = 0;
+  int high = node->count;
+  int middle;
+  int comparison;
+
+  *found = 0;
+  while (low < high)
+  {
+    middle = (low + high) / 2;
+    comparison = bpnode_compare(node, middle, key, prefix);
+    if (comparison == 0)
+    {
+      *found = 1;
+      return middle;
+    }
+    if (comparison < 0) high = middle;
+    else low = middle + 1;
+  }
+  return low;
+}
+
+/**
+ * index of the child of an internal node which may hold a given key
+ */
+int bpnode_child_index(const bpnode* node, const char* key, const unsigned long long prefix);
+int bpnode_child_index(const bpnode* node, const char* key, const unsigned long long prefix)
+{
+  int found;
+  int index = bpnode_lower_bound(node, key, prefix, &found);
+
+  /* keys equal to separator i live in child i + 1 */
+  return found ? index + 1 : index;
+}
+
+/**
+ * moves count keys between (or within) nodes
+ */
+void bpnode_move_keys(bpnode* target, const int target_index, bpnode* source, const int source_index, const int count);
+void bpnode_move_keys(bpnode* target, const int target_index, bpnode* source, const int source_index, const int count)
+{
+  if (count <= 0) return;
+  memmove(target->keys + target_index, source->keys + source_index, count * sizeof(char*));
+  memmove(target->prefixes + target_index, source->prefixes + source_index, count * sizeof(unsigned long long));
+}
+
+/**
+ * copies a key with the allocator of the tree
+ */
+char* bptree_copy_key(bptree* tree, const char* key);
+char* bptree_copy_key(bptree* tree, const char* key)
+{
+  size_t length = strlen(key) + 1;
+  char* copy = (char*)allocator_allocate(tree->allocator_, length);
+
+  memcpy(copy, key, length);
+  return copy;
+}
+
+/**
+ * creates an empty node
+ */
+bpnode* bpnode_create(bptree* tree, const int leaf);
+bpnode* bpnode_create(bptree* tree, const int leaf)
+{
+  size_t size = leaf ? sizeof(bpleaf) : sizeof(bpinternal);
+  bpnode* node = (bpnode*)allocator_allocate(tree->allocator_, size);
+
+  memset(node, 0, size);
+  node->leaf = leaf;
+  return node;
+}
+
+/**
+ * deletes a node with its children and keys
+ */
+void bpnode_destroy_with_children(bptree* tree, bpnode* node);
+void bpnode_destroy_with_children(bptree* tree, bpnode* node)
+{
+  int loop;
+
+  for (loop = 0; loop < node->count; loop++)
+  {
+    allocator_release(tree->allocator_, node->keys[loop]);
+  }
+  if (!node->leaf)
+  {
+    for (loop = 0; loop <= node->count; loop++)
+    {
+      bpnode_destroy_with_children(tree, bpnode_as_internal(node)->children[loop]);
+    }
+  }
+  allocator_release(tree->allocator_, node);
+}
+
+/**
+ * finds the leaf which may hold a given key
+ */
+bpleaf* bptree_find_leaf(bptree* tree, const char* key, const unsigned long long prefix);
+bpleaf* bptree_find_leaf(bptree* tree, const char* key, const unsigned long long prefix)
+{
+  bpnode* node = tree->root;
+
+  if (!node) return 0;
+  while (!node->leaf)
+  {
+    node = bpnode_as_internal(node)->children[bpnode_child_index(node, key, prefix)];
+  }
+  return bpnode_as_leaf(node);
+}
+
+/**
+ * inserts a key into the subtree of a node. when node splits, right is set to the new
+ * node and separator to the key which separates them.
+ * returns 0 if key already exists.
+ */
+int bpnode_insert(bptree* tree, bpnode* node, const char* key, const unsigned long long prefix, void* data, const int tag, bpnode** right, char** separator);
+int bpnode_insert(bptree* tree, bpnode* node, const char* key, const unsigned long long prefix, void* data, const int tag, bpnode** right, char** separator)
+{
+  bpleaf* leaf;
+  bpleaf* new_leaf;
+  bpinternal* internal;
+  bpinternal* new_internal;
+  bpnode* target;
+  bpnode* child_right = 0;
+  char* child_separator = 0;
+  int index;
+  int found;
+  int half = BPTREE_ORDER / 2;
+
+  *right = 0;
+  if (node->leaf)
+  {
+    leaf = bpnode_as_leaf(node);
+    index = bpnode_lower_bound(node, key, prefix, &found);
+    if (found) return 0;
+    target = node;
+    if (node->count == BPTREE_ORDER)
+    {
+      /* split leaf in half, upper half goes to a new leaf */
+      new_leaf = bpnode_as_leaf(bpnode_create(tree, 1));
+      bpnode_move_keys(&new_leaf->base, 0, node, half, BPTREE_ORDER - half);
+      memcpy(new_leaf->values, leaf->values + half, (BPTREE_ORDER - half) * sizeof(generic));
+      new_leaf->base.count = BPTREE_ORDER - half;
+      node->count = half;
+      new_leaf->next = leaf->next;
+      new_leaf->prev = leaf;
+      if (leaf->next) leaf->next->prev = new_leaf;
+      leaf->next = new_leaf;
+      if (index > half)
+      {
+        target = &new_leaf->base;
+        index -= half;
+      }
+      *right = &new_leaf->base;
+    }
+    bpnode_move_keys(target, index + 1, target, index, target->count - index);
+    memmove(bpnode_as_leaf(target)->values + index + 1, bpnode_as_leaf(target)->values + index, (target->count - index) * sizeof(generic));
+    target->keys[index] = bptree_copy_key(tree, key);
+    target->prefixes[index] = prefix;
+    bpnode_as_leaf(target)->values[index].pointer = data;
+    bpnode_as_leaf(target)->values[index].tag = tag;
+    ++(target->count);
+    if (*right) *separator = bptree_copy_key(tree, (*right)->keys[0]);
+    return 1;
+  }
+
+  internal = bpnode_as_internal(node);
+  index = bpnode_child_index(node, key, prefix);
+  if (!bpnode_insert(tree, internal->children[index], key, prefix, data, tag, &child_right, &child_separator)) return 0;
+  if (!child_right) return 1;
+
+  target = node;
+  if (node->count == BPTREE_ORDER)
+  {
+    /* split internal node, middle key moves up */
+    new_internal = bpnode_as_internal(bpnode_create(tree, 0));
+    bpnode_move_keys(&new_internal->base, 0, node, half + 1, BPTREE_ORDER - half - 1);
+    memcpy(new_internal->children, internal->children + half + 1, (BPTREE_ORDER - half) * sizeof(bpnode*));
+    new_internal->base.count = BPTREE_ORDER - half - 1;
+    node->count = half;
+    *separator = node->keys[half];
+    *right = &new_internal->base;
+    if (index > half)
+    {
+      target = &new_internal->base;
+      index -= half + 1;
+    }
+  }
+  bpnode_move_keys(target, index + 1, target, index, target->count - index);
+  memmove(bpnode_as_internal(target)->children + index + 2, bpnode_as_internal(target)->children + index + 1, (target->count - index) * sizeof(bpnode*));
+  target->keys[index] = child_separator;
+  target->prefixes[index] = bptree_key_prefix(child_separator);
+  bpnode_as_internal(target)->children[index + 1] = child_right;
+  ++(target->count);
+  return 1;
+}
+
+/**
+ * removes key i and child i + 1 of an internal node. key isn't released.
+ */
+void bpnode_remove_separator(bpnode* node, const int index);
+void bpnode_remove_separator(bpnode* node, const int index)
+{
+  bpinternal* internal = bpnode_as_internal(node);
+
+  bpnode_move_keys(node, index, node, index + 1, node->count - index - 1);
+  memmove(internal->children + index + 1, internal->children + index + 2, (node->count - index - 1) * sizeof(bpnode*));
+  --(node->count);
+}
+
+/**
+ * refills child i of an internal node which has fallen below minimum by borrowing
+ * from or merging with one of its siblings.
+ */
+void bpnode_rebalance(bptree* tree, bpnode* node, const int index);
+void bpnode_rebalance(bptree* tree, bpnode* node, const int index)
+{
+  bpinternal* parent = bpnode_as_internal(node);
+  bpnode* child = parent->children[index];
+  bpnode* left = index > 0 ? parent->children[index - 1] : 0;
+  bpnode* right = index < node->count ? parent->children[index + 1] : 0;
+  bpnode* merged;
+
+  if (child->leaf)
+  {
+    if (left && left->count > bpnode_minimum(left))
+    {
+      /* last pair of left sibling becomes the first pair of child */
+      bpnode_move_keys(child, 1, child, 0, child->count);
+      memmove(bpnode_as_leaf(child)->values + 1, bpnode_as_leaf(child)->values, child->count * sizeof(generic));
+      bpnode_move_keys(child, 0, left, left->count - 1, 1);
+      bpnode_as_leaf(child)->values[0] = bpnode_as_leaf(left)->values[left->count - 1];
+      --(left->count);
+      ++(child->count);
+      allocator_release(tree->allocator_, node->keys[index - 1]);
+      node->keys[index - 1] = bptree_copy_key(tree, child->keys[0]);
+      node->prefixes[index - 1] = child->prefixes[0];
+      return;
+    }
+    if (right && right->count > bpnode_minimum(right))
+    {
+      /* first pair of right sibling becomes the last pair of child */
+      bpnode_move_keys(child, child->count, right, 0, 1);
+      bpnode_as_leaf(child)->values[child->count] = bpnode_as_leaf(right)->values[0];
+      bpnode_move_keys(right, 0, right, 1, right->count - 1);
+      memmove(bpnode_as_leaf(right)->values, bpnode_as_leaf(right)->values + 1, (right->count - 1) * sizeof(generic));
+      --(right->count);
+      ++(child->count);
+      allocator_release(tree->allocator_, node->keys[index]);
+      node->keys[index] = bptree_copy_key(tree, right->keys[0]);
+      node->prefixes[index] = right->prefixes[0];
+      return;
+    }
+    /* merge child with a sibling, right one of the pair goes away */
+    if (left)
+    {
+      merged = child;
+      child = left;
+    }
+    else
+    {
+      merged = right;
+    }
+    bpnode_move_keys(child, child->count, merged, 0, merged->count);
+    memcpy(bpnode_as_leaf(child)->values + child->count, bpnode_as_leaf(merged)->values, merged->count * sizeof(generic));
+    child->count += merged->count;
+    bpnode_as_leaf(child)->next = bpnode_as_leaf(merged)->next;
+    if (bpnode_as_leaf(merged)->next) bpnode_as_leaf(merged)->next->prev = bpnode_as_leaf(child);
+    allocator_release(tree->allocator_, node->keys[left ? index - 1 : index]);
+    bpnode_remove_separator(node, left ? index - 1 : index);
+    allocator_release(tree->allocator_, merged);
+    return;
+  }
+
+  if (left && left->count > bpnode_minimum(left))
+  {
+    /* separator comes down to child, last key of left sibling goes up */
+    bpnode_move_keys(child, 1, child, 0, child->count);
+    memmove(bpnode_as_internal(child)->children + 1, bpnode_as_internal(child)->children, (child->count + 1) * sizeof(bpnode*));
+    bpnode_move_keys(child, 0, node, index - 1, 1);
+    bpnode_as_internal(child)->children[0] = bpnode_as_internal(left)->children[left->count];
+    bpnode_move_keys(node, index - 1, left, left->count - 1, 1);
+    --(left->count);
+    ++(child->count);
+    return;
+  }
+  if (right && right->count > bpnode_minimum(right))
+  {
+    /* separator comes down to child, first key of right sibling goes up */
+    bpnode_move_keys(child, child->count, node, index, 1);
+    bpnode_as_internal(child)->children[child->count + 1] = bpnode_as_internal(right)->children[0];
+    bpnode_move_keys(node, index, right, 0, 1);
+    bpnode_move_keys(right, 0, right, 1, right->count - 1);
+    memmove(bpnode_as_internal(right)->children, bpnode_as_internal(right)->children + 1, right->count * sizeof(bpnode*));
+    --(right->count);
+    ++(child->count);
+    return;
+  }
+  /* merge child with a sibling, separator comes down between them */
+  if (left)
+  {
+    merged = child;
+    child = left;
+  }
+  else
+  {
+    merged = right;
+  }
+  bpnode_move_keys(child, child->count, node, left ? index - 1 : index, 1);
+  bpnode_move_keys(child, child->count + 1, merged, 0, merged->count);
+  memcpy(bpnode_as_internal(child)->children + child->count + 1, bpnode_as_internal(merged)->children, (merged->count + 1) * sizeof(bpnode*));
+  child->count += merged->count + 1;
+  bpnode_remove_separator(node, left ? index - 1 : index);
+  allocator_release(tree->allocator_, merged);
+}
+
+/**
+ * removes a key from the subtree of a node
+ * returns 0 if key is not found.
+ */
+int bpnode_remove(bptree* tree, bpnode* node, const char* key, const unsigned long long prefix);
+int bpnode_remove(bptree* tree, bpnode* node, const char* key, const unsigned long long prefix)
+{
+  bpleaf* leaf;
+  bpinternal* internal;
+  int index;
+  int found;
+
+  if (node->leaf)
+  {
+    leaf = bpnode_as_leaf(node);
+    index = bpnode_lower_bound(node, key, prefix, &found);
+    if (!found) return 0;
+    allocator_release(tree->allocator_, node->keys[index]);
+    bpnode_move_keys(node, index, node, index + 1, node->count - index - 1);
+    memmove(leaf->values + index, leaf->values + index + 1, (node->count - index - 1) * sizeof(generic));
+    --(node->count);
+    return 1;
+  }
+  internal = bpnode_as_internal(node);
+  index = bpnode_child_index(node, key, prefix);
+  if (!bpnode_remove(tree, internal->children[index], key, prefix)) return 0;
+  if (internal->children[index]->count < bpnode_minimum(internal->children[index])) bpnode_rebalance(tree, node, index);
+  return 1;
+}
+
+bptree* bptree_alloc()
+{
+  return bptree_alloc_with(0);
+}
+
+bptree* bptree_alloc_with(const allocator* allocator_)
+{
+  bptree* new_tree;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_tree = (bptree*)allocator_allocate(allocator_, sizeof(bptree));
+  memset(new_tree, 0, sizeof(bptree));
+  new_tree->allocator_ = allocator_;
+  return new_tree;
+}
+
+void bptree_free(bptree* tree)
+{
+  if (tree->root) bpnode_destroy_with_children(tree, tree->root);
+  allocator_release(tree->allocator_, tree);
+}
+
+void bptree_insert(bptree* tree, const char* key, void* data, const int tag)
+{
+  const unsigned long long prefix = bptree_key_prefix(key);
+  bpnode* right;
+  char* separator;
+  bpinternal* root;
+
+  if (!tree->root) tree->root = bpnode_create(tree, 1);
+  if (!bpnode_insert(tree, tree->root, key, prefix, data, tag, &right, &separator)) return;
+  ++(tree->size);
+  if (right)
+  {
+    /* root has split, tree grows by one level */
+    root = bpnode_as_internal(bpnode_create(tree, 0));
+    root->base.keys[0] = separator;
+    root->base.prefixes[0] = bptree_key_prefix(separator);
+    root->base.count = 1;
+    root->children[0] = tree->root;
+    root->children[1] = right;
+    tree->root = &root->base;
+  }
+}
+
+generic* bptree_search(bptree* tree, const char* key)
+{
+  const unsigned long long prefix = bptree_key_prefix(key);
+  bpleaf* leaf = bptree_find_leaf(tree, key, prefix);
+  int index;
+  int found;
+
+  if (!leaf) return 0;
+  index = bpnode_lower_bound(&leaf->base, key, prefix, &found);
+  return found ? &leaf->values[index] : 0;
+}
+
+int bptree_remove(bptree* tree, const char* key)
+{
+  bpnode* root = tree->root;
+
+  if (!root || !bpnode_remove(tree, root, key, bptree_key_prefix(key))) return 0;
+  --(tree->size);
+  if (!root->leaf && root->count == 0)
+  {
+    /* root has a single child left, tree shrinks by one level */
+    tree->root = bpnode_as_internal(root)->children[0];
+    allocator_release(tree->allocator_, root);
+  }
+  else if (root->leaf && root->count == 0)
+  {
+    tree->root = 0;
+    allocator_release(tree->allocator_, root);
+  }
+  return 1;
+}
+
+int bptree_first(bptree* tree, bptree_iterator* iterator)
+{
+  bpnode* node = tree->root;
+
+  if (!node) return 0;
+  while (!node->leaf)
+  {
+    node = bpnode_as_internal(node)->children[0];
+  }
+  iterator->leaf = bpnode_as_leaf(node);
+  iterator->index = 0;
+  return node->count > 0;
+}
+
+int bptree_lower_bound(bptree* tree, const char* key, bptree_iterator* iterator)
+{
+  const unsigned long long prefix = bptree_key_prefix(key);
+  bpleaf* leaf = bptree_find_leaf(tree, key, prefix);
+  int found;
+
+  if (!leaf) return 0;
+  iterator->leaf = leaf;
+  iterator->index = bpnode_lower_bound(&leaf->base, key, prefix, &found);
+  if (iterator->index < leaf->base.count) return 1;
+  /* all keys of the leaf are less than key, bound is the first key of the next leaf */
+  iterator->leaf = leaf->next;
+  iterator->index = 0;
+  return iterator->leaf != 0;
+}
+
+int bptree_next(bptree_iterator* iterator)
+{
+  if (++(iterator->index) < iterator->leaf->base.count) return 1;
+  iterator->leaf = iterator->leaf->next;
+  iterator->index = 0;
+  return iterator->leaf != 0;
+}
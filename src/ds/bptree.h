@@ -0,0 +1,169 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  b+tree based ordered map
+*/
+
+#ifndef __VISUEM_BPTREE_H__
+#define __VISUEM_BPTREE_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief maximum number of keys in a b+tree node
+   */
+#define BPTREE_ORDER 32
+
+  /** 
+   * /brief common part of b+tree nodes
+   * keys are kept sorted together with their first 8 bytes packed in big-endian order.
+   * searching a node is a binary search over the contiguous prefix array which touches
+   * key strings only when prefixes are equal.
+   */
+  typedef struct 
+  {
+    int                   leaf;                         /* is node a leaf */
+    int                   count;                        /* number of keys in node */
+    unsigned long long    prefixes[BPTREE_ORDER];       /* first 8 bytes of keys */
+    char*                 keys[BPTREE_ORDER];           /* keys */
+  } bpnode;
+
+  /** 
+   * /brief internal b+tree node. keys are separators, child i holds keys less than key i.
+   */
+  typedef struct 
+  {
+    bpnode                base;
+    bpnode*               children[BPTREE_ORDER + 1];
+  } bpinternal;
+
+  /** 
+   * /brief leaf b+tree node. leaves are linked in key order.
+   */
+  typedef struct bpleaf_ 
+  {
+    bpnode                base;
+    generic               values[BPTREE_ORDER];
+    struct bpleaf_ *      next;
+    struct bpleaf_ *      prev;
+  } bpleaf;
+
+  /** 
+   * /brief b+tree based map
+   */
+  typedef struct 
+  {
+    bpnode*               root;
+    int                   size;
+    const allocator*      allocator_;
+  } bptree;
+
+  /** 
+   * /brief position of a key-value pair within a b+tree
+   */
+  typedef struct 
+  {
+    bpleaf*               leaf;
+    int                   index;
+  } bptree_iterator;
+
+  /** 
+   * /brief key at an iterator
+   */
+#define bptree_iterator_key(it) ((const char*)(it)->leaf->base.keys[(it)->index])
+
+  /** 
+   * /brief value at an iterator
+   */
+#define bptree_iterator_value(it) (&(it)->leaf->values[(it)->index])
+
+  /** 
+   * /brief allocates a b+tree
+   */
+  extern bptree* bptree_alloc();
+
+  /** 
+   * /brief allocates a b+tree which gets its memory from a given allocator
+   */
+  extern bptree* bptree_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes a b+tree
+   * not responsible for deallocation of data within nodes
+   */    
+  extern void bptree_free(bptree* tree);
+
+  /** 
+   * /brief inserts a key-value pair into b+tree. 
+   * key is copied. nothing is changed if key already exists.
+   */
+  extern void bptree_insert(bptree* tree, const char* key, void* data, const int tag);
+
+  /** 
+   * /brief searches a b+tree with a specific key 
+   *
+   * /return pointer to element related with given key.
+   *         a null pointer if key is not found.
+   */
+  extern generic* bptree_search(bptree* tree, const char* key);
+
+  /** 
+   * /brief removes a key from b+tree
+   * /return 1 if key is removed, 0 if it is not found.
+   */
+  extern int bptree_remove(bptree* tree, const char* key);
+
+  /** 
+   * /brief points iterator to the smallest key
+   * /return 0 if tree is empty.
+   */
+  extern int bptree_first(bptree* tree, bptree_iterator* iterator);
+
+  /** 
+   * /brief points iterator to the first key which is not less than a given key
+   * /return 0 if there is no such key.
+   */
+  extern int bptree_lower_bound(bptree* tree, const char* key, bptree_iterator* iterator);
+
+  /** 
+   * /brief advances iterator to the next key
+   * /return 0 if there are no more keys.
+   */
+  extern int bptree_next(bptree_iterator* iterator);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
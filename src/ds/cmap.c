@@ -0,0 +1,354 @@
+#include "cmap.h"
+#include "hash.h"
+#include <stdatomic.h>
+#include <string.h> /* strcmp */
+#include <memory.h> /* memset */
+
+/**
+ * hash values with special meaning in table entries. real hashes are moved above them.
+ */
+#define CMAP_EMPTY      0ULL
+#define CMAP_DELETED    1ULL
+
+/**
+ * initial number of entries of a shard table
+ */
+#define CMAP_INITIAL_CAPACITY 16
+
+/**
+ * table entry. readers look at entries while a writer changes them, so every field is
+ * atomic. key bytes are written before key is stored and key before hash, both with
+ * release, so a reader which acquires a matching hash and then key sees a complete key.
+ * key bytes never change and aren't released before reclaim. value is copied out 
+ * relaxed and only trusted after sequence of shard is validated.
+ */
+typedef struct
+{
+  _Atomic unsigned long long hash;
+  _Atomic(char*)        key;
+  _Atomic(void*)        pointer;      /* value */
+  atomic_int            tag;          /* value tag */
+} cmap_entry;
+
+/**
+ * open addressing table of a shard. readers may hold on to a table while a writer
+ * replaces it, so outgrown tables are retired rather than released.
+ */
+typedef struct
+{
+  int                   capacity;
+  cmap_entry            entries[1];
+} cmap_table;
+
+/**
+ * shard of a concurrent map
+ */
+typedef struct
+{
+  atomic_uint           sequence;     /* odd while a writer is modifying shard */
+  atomic_flag           lock;         /* serializes writers */
+  _Atomic(cmap_table*)  table;        /* current table */
+  atomic_int            size;         /* number of keys, written under lock, read without */
+  int                   used;         /* number of non empty entries, deleted ones included */
+  void**                retired;      /* memory to release on reclaim */
+  int                   retired_count;
+  int                   retired_capacity;
+  char                  padding[64];  /* keeps writers of neighbour shards off each other's cache lines */
+} cmap_shard;
+
+struct cmap_
+{
+  cmap_shard            shards[CMAP_SHARD_COUNT];
+  const allocator*      allocator_;
+};
+
+/**
+ * hash of a key, kept away from the special values
+ */
+unsigned long long cmap_hash(const char* key);
+unsigned long long cmap_hash(const char* key)
+{
+  unsigned long long hash = hash_string(key);
+
+  return hash <= CMAP_DELETED ? hash + 2 : hash;
+}
+
+/**
+ * shard of a hash. top bits select the shard, low bits the entry within it.
+ */
+#define cmap_shard_of(m, h) (&(m)->shards[(h) >> 60 & (CMAP_SHARD_COUNT - 1)])
+
+/**
+ * creates an empty table
+ */
+cmap_table* cmap_table_create(cmap* map_, const int capacity);
+cmap_table* cmap_table_create(cmap* map_, const int capacity)
+{
+  size_t size = sizeof(cmap_table) + (capacity - 1) * sizeof(cmap_entry);
+  cmap_table* table = (cmap_table*)allocator_allocate(map_->allocator_, size);
+
+  memset(table, 0, size);
+  table->capacity = capacity;
+  return table;
+}
+
+/**
+ * keeps a block until next reclaim
+ */
+void cmap_retire(cmap* map_, cmap_shard* shard, void* pointer);
+void cmap_retire(cmap* map_, cmap_shard* shard, void* pointer)
+{
+  if (shard->retired_count == shard->retired_capacity)
+  {
+    shard->retired_capacity += shard->retired_capacity ? shard->retired_capacity : 8;
+    shard->retired = (void**)allocator_reallocate(map_->allocator_, shard->retired, shard->retired_capacity * sizeof(void*));
+  }
+  shard->retired[(shard->retired_count)++] = pointer;
+}
+
+/**
+ * hash of an entry
+ */
+#define cmap_entry_hash(e) atomic_load_explicit(&(e)->hash, memory_order_acquire)
+
+/**
+ * fills an entry and publishes it by storing its hash last
+ */
+void cmap_entry_set(cmap_entry* entry, const unsigned long long hash, char* key, void* data, const int tag);
+void cmap_entry_set(cmap_entry* entry, const unsigned long long hash, char* key, void* data, const int tag)
+{
+  atomic_store_explicit(&entry->pointer, data, memory_order_relaxed);
+  atomic_store_explicit(&entry->tag, tag, memory_order_relaxed);
+  atomic_store_explicit(&entry->key, key, memory_order_release);
+  atomic_store_explicit(&entry->hash, hash, memory_order_release);
+}
+
+/**
+ * finds entry of a key in a table, returns -1 if key is not found
+ */
+int cmap_table_find(const cmap_table* table, const char* key, const unsigned long long hash);
+int cmap_table_find(const cmap_table* table, const char* key, const unsigned long long hash)
+{
+  const int mask = table->capacity - 1;
+  int index = (int)(hash & (unsigned long long)mask);
+  unsigned long long entry;
+  int probe;
+
+  for (probe = 0; probe < table->capacity; probe++)
+  {
+    entry = cmap_entry_hash(&table->entries[index]);
+    if (entry == CMAP_EMPTY) return -1;
+    if (entry == hash && strcmp(atomic_load_explicit(&table->entries[index].key, memory_order_acquire), key) == 0) return index;
+    index = (index + 1) & mask;
+  }
+  return -1;
+}
+
+/**
+ * finds a free entry for a hash in a table
+ */
+int cmap_table_find_free(const cmap_table* table, const unsigned long long hash);
+int cmap_table_find_free(const cmap_table* table, const unsigned long long hash)
+{
+  const int mask = table->capacity - 1;
+  int index = (int)(hash & (unsigned long long)mask);
+
+  while (cmap_entry_hash(&table->entries[index]) > CMAP_DELETED)
+  {
+    index = (index + 1) & mask;
+  }
+  return index;
+}
+
+/**
+ * locks a shard for writing
+ */
+void cmap_write_begin(cmap_shard* shard);
+void cmap_write_begin(cmap_shard* shard)
+{
+  while (atomic_flag_test_and_set_explicit(&shard->lock, memory_order_acquire));
+  atomic_fetch_add_explicit(&shard->sequence, 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+}
+
+/**
+ * unlocks a shard after writing
+ */
+void cmap_write_end(cmap_shard* shard);
+void cmap_write_end(cmap_shard* shard)
+{
+  atomic_fetch_add_explicit(&shard->sequence, 1, memory_order_release);
+  atomic_flag_clear_explicit(&shard->lock, memory_order_release);
+}
+
+cmap* cmap_alloc()
+{
+  return cmap_alloc_with(0);
+}
+
+cmap* cmap_alloc_with(const allocator* allocator_)
+{
+  cmap* new_map;
+  int loop;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_map = (cmap*)allocator_allocate(allocator_, sizeof(cmap));
+  memset(new_map, 0, sizeof(cmap));
+  new_map->allocator_ = allocator_;
+  for (loop = 0; loop < CMAP_SHARD_COUNT; loop++)
+  {
+    atomic_init(&new_map->shards[loop].sequence, 0);
+    atomic_init(&new_map->shards[loop].size, 0);
+    atomic_flag_clear(&new_map->shards[loop].lock);
+    atomic_init(&new_map->shards[loop].table, cmap_table_create(new_map, CMAP_INITIAL_CAPACITY));
+  }
+  return new_map;
+}
+
+void cmap_free(cmap* map_)
+{
+  cmap_shard* shard;
+  cmap_table* table;
+  int loop;
+  int entry;
+
+  cmap_reclaim(map_);
+  for (loop = 0; loop < CMAP_SHARD_COUNT; loop++)
+  {
+    shard = &map_->shards[loop];
+    table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    for (entry = 0; entry < table->capacity; entry++)
+    {
+      if (cmap_entry_hash(&table->entries[entry]) > CMAP_DELETED) allocator_release(map_->allocator_, atomic_load_explicit(&table->entries[entry].key, memory_order_relaxed));
+    }
+    allocator_release(map_->allocator_, table);
+    if (shard->retired) allocator_release(map_->allocator_, shard->retired);
+  }
+  allocator_release(map_->allocator_, map_);
+}
+
+int cmap_insert(cmap* map_, const char* key, void* data, const int tag)
+{
+  const unsigned long long hash = cmap_hash(key);
+  const size_t length = strlen(key) + 1;
+  cmap_shard* shard = cmap_shard_of(map_, hash);
+  cmap_table* table;
+  cmap_table* grown;
+  cmap_entry* entry;
+  char* copy;
+  int size;
+  int loop;
+  int index;
+
+  cmap_write_begin(shard);
+  table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+  if (cmap_table_find(table, key, hash) >= 0)
+  {
+    cmap_write_end(shard);
+    return 0;
+  }
+  if ((shard->used + 1) * 4 > table->capacity * 3)
+  {
+    /* rebuild into a new table, old one stays readable until reclaim */
+    size = atomic_load_explicit(&shard->size, memory_order_relaxed);
+    grown = cmap_table_create(map_, (size + 1) * 2 > table->capacity / 2 ? table->capacity * 2 : table->capacity);
+    for (loop = 0; loop < table->capacity; loop++)
+    {
+      entry = &table->entries[loop];
+      if (cmap_entry_hash(entry) <= CMAP_DELETED) continue;
+      cmap_entry_set(&grown->entries[cmap_table_find_free(grown, cmap_entry_hash(entry))], cmap_entry_hash(entry), 
+                     atomic_load_explicit(&entry->key, memory_order_relaxed), 
+                     atomic_load_explicit(&entry->pointer, memory_order_relaxed), 
+                     atomic_load_explicit(&entry->tag, memory_order_relaxed));
+    }
+    atomic_store_explicit(&shard->table, grown, memory_order_release);
+    cmap_retire(map_, shard, table);
+    table = grown;
+    shard->used = size;
+  }
+  index = cmap_table_find_free(table, hash);
+  entry = &table->entries[index];
+  if (cmap_entry_hash(entry) == CMAP_EMPTY) ++(shard->used);
+  copy = (char*)allocator_allocate(map_->allocator_, length);
+  memcpy(copy, key, length);
+  cmap_entry_set(entry, hash, copy, data, tag);
+  atomic_fetch_add_explicit(&shard->size, 1, memory_order_relaxed);
+  cmap_write_end(shard);
+  return 1;
+}
+
+int cmap_search(cmap* map_, const char* key, generic* value)
+{
+  const unsigned long long hash = cmap_hash(key);
+  cmap_shard* shard = cmap_shard_of(map_, hash);
+  const cmap_table* table;
+  unsigned int sequence;
+  int index;
+
+  for (;;)
+  {
+    sequence = atomic_load_explicit(&shard->sequence, memory_order_acquire);
+    if (sequence & 1) continue;
+    table = atomic_load_explicit(&shard->table, memory_order_acquire);
+    index = cmap_table_find(table, key, hash);
+    if (index >= 0) 
+    {
+      value->pointer = atomic_load_explicit(&table->entries[index].pointer, memory_order_relaxed);
+      value->tag = atomic_load_explicit(&table->entries[index].tag, memory_order_relaxed);
+    }
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&shard->sequence, memory_order_relaxed) == sequence) return index >= 0;
+  }
+}
+
+int cmap_remove(cmap* map_, const char* key)
+{
+  const unsigned long long hash = cmap_hash(key);
+  cmap_shard* shard = cmap_shard_of(map_, hash);
+  cmap_table* table;
+  int index;
+
+  cmap_write_begin(shard);
+  table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+  index = cmap_table_find(table, key, hash);
+  if (index >= 0)
+  {
+    atomic_store_explicit(&table->entries[index].hash, CMAP_DELETED, memory_order_release);
+    cmap_retire(map_, shard, atomic_load_explicit(&table->entries[index].key, memory_order_relaxed));
+    atomic_fetch_sub_explicit(&shard->size, 1, memory_order_relaxed);
+  }
+  cmap_write_end(shard);
+  return index >= 0;
+}
+
+int cmap_size(cmap* map_)
+{
+  int size = 0;
+  int loop;
+
+  /* shards are summed one by one, a snapshot only while no writer is active */
+  for (loop = 0; loop < CMAP_SHARD_COUNT; loop++)
+  {
+    size += atomic_load_explicit(&map_->shards[loop].size, memory_order_relaxed);
+  }
+  return size;
+}
+
+void cmap_reclaim(cmap* map_)
+{
+  cmap_shard* shard;
+  int loop;
+  int retired;
+
+  for (loop = 0; loop < CMAP_SHARD_COUNT; loop++)
+  {
+    shard = &map_->shards[loop];
+    cmap_write_begin(shard);
+    for (retired = 0; retired < shard->retired_count; retired++)
+    {
+      allocator_release(map_->allocator_, shard->retired[retired]);
+    }
+    shard->retired_count = 0;
+    cmap_write_end(shard);
+  }
+}
@@ -0,0 +1,116 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  concurrent read-mostly hash map with string keys
+*/
+
+#ifndef __VISUEM_CMAP_H__
+#define __VISUEM_CMAP_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief number of independently locked shards of a concurrent map
+   */
+#define CMAP_SHARD_COUNT 16
+
+  /** 
+   * /brief concurrent map
+   * keys are spread over shards. each shard is an open addressing table guarded by a 
+   * sequence lock: readers never write shared memory, they read optimistically and 
+   * retry if a writer of the same shard was active meanwhile. writers of a shard are 
+   * serialized by a spin lock, writers of different shards don't interfere.
+   *
+   * memory which readers might still be looking at (removed keys, outgrown tables) is 
+   * not released immediately but retired. call cmap_reclaim at a point where no reader 
+   * is inside the map to release it.
+   */
+  typedef struct cmap_ cmap;
+
+  /** 
+   * /brief allocates a concurrent map
+   */
+  extern cmap* cmap_alloc();
+
+  /** 
+   * /brief allocates a concurrent map which gets its memory from a given allocator.
+   * allocator must be thread safe.
+   */
+  extern cmap* cmap_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes a concurrent map. no other thread may be using it.
+   * not responsible for deallocation of data within nodes
+   */    
+  extern void cmap_free(cmap* map_);
+
+  /** 
+   * /brief inserts a key-value pair into map. 
+   * key is copied. nothing is changed if key already exists.
+   * /return 1 if key is inserted, 0 if it already exists.
+   */
+  extern int cmap_insert(cmap* map_, const char* key, void* data, const int tag);
+
+  /** 
+   * /brief searches map with a specific key. safe to call from any number of threads
+   * concurrently with each other and with writers.
+   *
+   * /return 1 and copies the element related with given key into value if key is found, 
+   *         0 otherwise.
+   */
+  extern int cmap_search(cmap* map_, const char* key, generic* value);
+
+  /** 
+   * /brief removes a key from map
+   * /return 1 if key is removed, 0 if it is not found.
+   */
+  extern int cmap_remove(cmap* map_, const char* key);
+
+  /** 
+   * /brief number of keys in map
+   * doesn't lock any shard, so it's exact only while no writer is active.
+   */
+  extern int cmap_size(cmap* map_);
+
+  /** 
+   * /brief releases memory retired by writers. 
+   * caller must make sure no thread is searching the map while this runs.
+   */
+  extern void cmap_reclaim(cmap* map_);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,12 @@
+#include "compact_array.h"
+
+ARRAY_DEFINE(compact_array, compact_generic)
+
+generic compact_generic_expand(const compact_generic compact)
+{
+  generic expanded;
+
+  expanded.pointer = compact_generic_pointer(compact);
+  expanded.tag = compact_generic_tag(compact);
+  return expanded;
+}
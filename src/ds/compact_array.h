@@ -0,0 +1,97 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  8-byte typeless data container and its dynamic array
+*/
+
+#ifndef __VISUEM_COMPACT_ARRAY_H__
+#define __VISUEM_COMPACT_ARRAY_H__
+
+#include <stdint.h> /* uintptr_t */
+#include "generic.h"
+#include "typed_array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief compact typeless data container
+   * a generic packed into 8 bytes: pointer in low 48 bits, tag in high 16 bits. 
+   * generic pads to 16 bytes on 64-bit targets, so compact ones take half the memory.
+   *
+   * pointers must fit into 48 bits, which holds for user space addresses on x86-64 
+   * and arm64 (unless 5-level paging is enabled). tags must fit into 16 signed bits.
+   */
+  typedef uint64_t compact_generic;
+
+  /**
+   * /brief builds a compact generic of a pointer and a tag
+   */
+#define compact_generic_make(p, t) (((uint64_t)(uintptr_t)(p) & 0x0000ffffffffffffULL) | ((uint64_t)(uint16_t)(t) << 48))
+
+  /**
+   * /brief pointer of a compact generic. bit 47 is sign extended to give back canonical addresses.
+   */
+#define compact_generic_pointer(c) ((void*)(uintptr_t)((int64_t)((uint64_t)(c) << 16) >> 16))
+
+  /**
+   * /brief tag of a compact generic
+   */
+#define compact_generic_tag(c) ((int)(int16_t)((uint64_t)(c) >> 48))
+
+  /**
+   * /brief compact generic with the same pointer and a different tag
+   */
+#define compact_generic_with_tag(c, t) (((uint64_t)(c) & 0x0000ffffffffffffULL) | ((uint64_t)(uint16_t)(t) << 48))
+
+  /**
+   * /brief compact generic of a generic
+   */
+#define compact_generic_of(g) compact_generic_make((g).pointer, (g).tag)
+
+  /**
+   * /brief generic of a compact generic
+   */
+  extern generic compact_generic_expand(const compact_generic compact);
+
+  /**
+   * /brief dynamic array of compact generics, stored by value.
+   * see ARRAY_DECLARE for its functions. eg.
+   *
+   *   compact_array_push(handles, compact_generic_make(texture, TEXTURE_TAG));
+   */
+  ARRAY_DECLARE(compact_array, compact_generic)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+#include "deque.h"
+#include <stdlib.h> /* malloc */
+#include <memory.h> /* memset */
+#include <string.h> /* memmove */
+
+/**
+ * block of the element at a given position
+ */
+#define deque_block_of(p) ((p) / DEQUE_BLOCK_SIZE)
+
+/**
+ * offset of the element at a given position within its block
+ */
+#define deque_offset_of(p) ((p) % DEQUE_BLOCK_SIZE)
+
+/**
+ * reallocates block map so that used blocks are centered with enough free slots on both ends.
+ * map is doubled only when used blocks occupy more than half of it. blocks which don't hold
+ * elements are released, used blocks themselves are not moved, so element addresses stay valid.
+ */
+void deque_grow_map(deque* deque_);
+void deque_grow_map(deque* deque_)
+{
+  int first = deque_block_of(deque_->begin);
+  int used = deque_->usage ? deque_block_of(deque_->begin + deque_->usage - 1) - first + 1 : 0;
+  int block_count = deque_->block_count ? deque_->block_count : 8;
+  int new_first;
+  int loop;
+  generic** blocks;
+
+  while (block_count < (used + 2) * 2)
+  {
+    block_count *= 2;
+  }
+  blocks = (generic**)allocator_allocate(deque_->allocator_, block_count * sizeof(generic*));
+  memset(blocks, 0, block_count * sizeof(generic*));
+  new_first = (block_count - used) / 2;
+  for (loop = 0; loop < deque_->block_count; loop++)
+  {
+    if (loop >= first && loop < first + used) continue;
+    if (deque_->blocks[loop]) allocator_release(deque_->allocator_, deque_->blocks[loop]);
+  }
+  if (used)
+  {
+    memcpy(blocks + new_first, deque_->blocks + first, used * sizeof(generic*));
+  }
+  if (deque_->blocks)
+  {
+    allocator_release(deque_->allocator_, deque_->blocks);
+  }
+  deque_->blocks = blocks;
+  deque_->block_count = block_count;
+  deque_->begin = new_first * DEQUE_BLOCK_SIZE + deque_offset_of(deque_->begin);
+  if (!deque_->usage)
+  {
+    deque_->begin = (block_count / 2) * DEQUE_BLOCK_SIZE;
+  }
+}
+
+/**
+ * returns slot of the element at a given position, allocating its block if necessary.
+ */
+generic* deque_slot(deque* deque_, const int position);
+generic* deque_slot(deque* deque_, const int position)
+{
+  generic** block = &deque_->blocks[deque_block_of(position)];
+
+  if (!*block)
+  {
+    *block = (generic*)allocator_allocate(deque_->allocator_, DEQUE_BLOCK_SIZE * sizeof(generic));
+  }
+  return &(*block)[deque_offset_of(position)];
+}
+
+deque* deque_alloc()
+{
+  return deque_alloc_with(0);
+}
+
+deque* deque_alloc_with(const allocator* allocator_)
+{
+  deque* new_deque;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_deque = (deque*)allocator_allocate(allocator_, sizeof(deque));
+  memset(new_deque, 0, sizeof(deque));
+  new_deque->allocator_ = allocator_;
+  return new_deque;
+}
+
+void deque_free(deque* deque_)
+{
+  deque_reset(deque_);
+  allocator_release(deque_->allocator_, deque_);
+}
+
+generic* deque_push_back(deque* deque_, void* data, const int tag)
+{
+  generic* element;
+
+  if (deque_->begin + deque_->usage >= deque_->block_count * DEQUE_BLOCK_SIZE)
+  {
+    deque_grow_map(deque_);
+  }
+  element = deque_slot(deque_, deque_->begin + deque_->usage);
+  element->pointer = data;
+  element->tag = tag;
+  ++(deque_->usage);
+  return element;
+}
+
+generic* deque_push_front(deque* deque_, void* data, const int tag)
+{
+  generic* element;
+
+  if (deque_->begin == 0)
+  {
+    deque_grow_map(deque_);
+  }
+  element = deque_slot(deque_, deque_->begin - 1);
+  element->pointer = data;
+  element->tag = tag;
+  --(deque_->begin);
+  ++(deque_->usage);
+  return element;
+}
+
+generic* deque_pop_back(deque* deque_)
+{
+  if (deque_->usage > 0)
+  {
+    --(deque_->usage);
+    return deque_at(deque_, deque_->usage);
+  }
+  return 0;
+}
+
+generic* deque_pop_front(deque* deque_)
+{
+  generic* element;
+
+  if (deque_->usage > 0)
+  {
+    element = deque_at(deque_, 0);
+    ++(deque_->begin);
+    --(deque_->usage);
+    return element;
+  }
+  return 0;
+}
+
+generic* deque_at(deque* deque_, const int index)
+{
+  const int position = deque_->begin + index;
+
+  return &deque_->blocks[deque_block_of(position)][deque_offset_of(position)];
+}
+
+int deque_block_count(deque* deque_)
+{
+  if (!deque_->usage) return 0;
+  return deque_block_of(deque_->begin + deque_->usage - 1) - deque_block_of(deque_->begin) + 1;
+}
+
+generic* deque_block(deque* deque_, const int block, int* count)
+{
+  const int first = deque_block_of(deque_->begin) + block;
+  const int end = deque_->begin + deque_->usage;
+  int start = first * DEQUE_BLOCK_SIZE;
+  int stop = start + DEQUE_BLOCK_SIZE;
+
+  if (start < deque_->begin) start = deque_->begin;
+  if (stop > end) stop = end;
+  *count = stop - start;
+  return deque_->blocks[first] + deque_offset_of(start);
+}
+
+void deque_reset(deque* deque_)
+{
+  int loop;
+
+  if (deque_->blocks)
+  {
+    for (loop = 0; loop < deque_->block_count; loop++)
+    {
+      if (deque_->blocks[loop]) allocator_release(deque_->allocator_, deque_->blocks[loop]);
+    }
+    allocator_release(deque_->allocator_, deque_->blocks);
+  }
+  deque_->blocks = 0;
+  deque_->block_count = 0;
+  deque_->begin = 0;
+  deque_->usage = 0;
+}
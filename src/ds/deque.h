@@ -0,0 +1,131 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  segmented double ended queue with stable element addresses
+*/
+
+#ifndef __VISUEM_DEQUE_H__
+#define __VISUEM_DEQUE_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief number of elements stored in a single block of a deque
+   */
+#define DEQUE_BLOCK_SIZE 64
+
+  /** 
+   * /brief deque structure
+   * elements are stored in fixed size blocks which never move once allocated. only the 
+   * block map is reallocated when deque grows, so element addresses stay valid until 
+   * the element is popped.
+   */      
+  typedef struct 
+  {   
+    generic** blocks;      /* block map */
+    int       block_count; /* capacity of block map */
+    int       begin;       /* position of the first element, counted in elements from the start of block map */
+    int       usage;       /* current usage of deque */
+    const allocator* allocator_;  /* allocator of deque, its map and blocks */
+  } deque; 
+
+  /**
+   * /brief creates an empty deque 
+   */
+  extern deque* deque_alloc();    
+
+  /**
+   * /brief creates an empty deque which gets its memory from a given allocator
+   */
+  extern deque* deque_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes a deque 
+   * not responsible for deallocation of data within nodes
+   */      
+  extern void deque_free(deque* deque_);
+
+  /** 
+   * /brief pushes an element to the end of the deque.
+   */        
+  extern generic* deque_push_back(deque* deque_, void* data, const int tag);      
+
+  /** 
+   * /brief pushes an element to the beginning of the deque.
+   */        
+  extern generic* deque_push_front(deque* deque_, void* data, const int tag);      
+
+  /**
+   * /brief pops back the element at the end of the deque.
+   * /return popped element. it stays valid until the next push.
+   */  
+  extern generic* deque_pop_back(deque* deque_);
+
+  /**
+   * /brief pops the element at the beginning of the deque.
+   * /return popped element. it stays valid until the next push.
+   */  
+  extern generic* deque_pop_front(deque* deque_);
+
+  /**
+   * /brief returns the element at a given index of the deque.
+   */  
+  extern generic* deque_at(deque* deque_, const int index);
+
+  /**
+   * /brief number of blocks which hold elements of the deque.
+   */  
+  extern int deque_block_count(deque* deque_);
+
+  /**
+   * /brief returns elements in a given block of the deque.
+   * blocks are counted from the beginning of the deque. first and last blocks may be 
+   * partially used.
+   *
+   * /return pointer to the first element in the block, count is set to the number of 
+   *         consecutive elements starting from there.
+   */  
+  extern generic* deque_block(deque* deque_, const int block, int* count);
+
+  /** 
+   * /brief clears all elements of the deque and releases its blocks.
+   * not responsible for deallocation of data within nodes
+   */
+  extern void deque_reset(deque* deque_);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,245 @@
+#include "frozen_map.h"
+#include <stdio.h> /* fopen */
+#include <stdlib.h> /* malloc */
+#include <string.h> /* strcmp */
+#include <stdint.h> /* uint64_t */
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h> /* mmap */
+#include <sys/stat.h> /* fstat */
+#include <fcntl.h> /* open */
+#include <unistd.h> /* close */
+#endif
+
+/**
+ * image identification
+ */
+#define FROZEN_MAP_MAGIC      "VSMFROZ"
+#define FROZEN_MAP_VERSION    1
+
+/**
+ * image header
+ */
+typedef struct
+{
+  char                  magic[8];
+  uint32_t              version;
+  uint32_t              count;          /* number of entries */
+  uint64_t              size;           /* size of image in bytes */
+  uint64_t              entries;        /* offset of first entry */
+} frozen_map_header;
+
+/**
+ * image entry. prefix is the same big-endian packing of first key bytes map uses.
+ */
+typedef struct
+{
+  uint64_t              prefix;
+  uint32_t              key;            /* offset of null terminated key */
+  uint32_t              length;         /* length of key */
+  uint64_t              payload;        /* value pointer */
+  int32_t               tag;            /* value tag */
+  uint32_t              reserved;
+} frozen_map_entry;
+
+struct frozen_map_
+{
+  const unsigned char*  base;
+  const frozen_map_entry* entries;
+  int                   count;
+  size_t                size;
+#ifdef _WIN32
+  HANDLE                file;
+  HANDLE                mapping;
+#endif
+};
+
+/**
+ * places sorted nodes at their eytzinger positions by an in-order walk of the
+ * implicit tree. children of index are at 2 * index + 1 and 2 * index + 2.
+ */
+void frozen_map_layout(rbnode** nodes, const int count, const int index, rbnode** cursor);
+void frozen_map_layout(rbnode** nodes, const int count, const int index, rbnode** cursor)
+{
+  if (index >= count) return;
+  frozen_map_layout(nodes, count, 2 * index + 1, cursor);
+  nodes[index] = *cursor;
+  *cursor = map_next(*cursor);
+  frozen_map_layout(nodes, count, 2 * index + 2, cursor);
+}
+
+/**
+ * checks that every key of an image lies within it and is null terminated there
+ */
+int frozen_map_validate(const unsigned char* base, const frozen_map_header* header);
+int frozen_map_validate(const unsigned char* base, const frozen_map_header* header)
+{
+  const frozen_map_entry* entries = (const frozen_map_entry*)(base + header->entries);
+  uint64_t end;
+  uint32_t loop;
+
+  for (loop = 0; loop < header->count; loop++)
+  {
+    end = (uint64_t)entries[loop].key + entries[loop].length;
+    if (end >= header->size || base[end] != 0) return 0;
+  }
+  return 1;
+}
+
+/**
+ * releases mapping of a frozen map
+ */
+void frozen_map_unmap(frozen_map* map_);
+void frozen_map_unmap(frozen_map* map_)
+{
+#ifdef _WIN32
+  if (map_->base) UnmapViewOfFile(map_->base);
+  if (map_->mapping) CloseHandle(map_->mapping);
+  if (map_->file != INVALID_HANDLE_VALUE) CloseHandle(map_->file);
+#else
+  if (map_->base) munmap((void*)map_->base, map_->size);
+#endif
+}
+
+int map_freeze(map* tree, const char* path)
+{
+  frozen_map_header header;
+  frozen_map_entry* entries;
+  rbnode** nodes;
+  rbnode* cursor;
+  FILE* file;
+  uint64_t offset;
+  int written;
+  int loop;
+
+  entries = (frozen_map_entry*)malloc((tree->size ? tree->size : 1) * sizeof(frozen_map_entry));
+  nodes = (rbnode**)malloc((tree->size ? tree->size : 1) * sizeof(rbnode*));
+  cursor = map_first(tree);
+  frozen_map_layout(nodes, tree->size, 0, &cursor);
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, FROZEN_MAP_MAGIC, sizeof(FROZEN_MAP_MAGIC));
+  header.version = FROZEN_MAP_VERSION;
+  header.count = (uint32_t)tree->size;
+  header.entries = sizeof(header);
+
+  /* keys follow entries in the same order, so top levels of the tree keep their keys close */
+  offset = header.entries + (uint64_t)tree->size * sizeof(frozen_map_entry);
+  for (loop = 0; loop < tree->size; loop++)
+  {
+    entries[loop].prefix = nodes[loop]->prefix;
+    entries[loop].key = (uint32_t)offset;
+    entries[loop].length = (uint32_t)nodes[loop]->length;
+    entries[loop].payload = (uint64_t)(uintptr_t)nodes[loop]->data.value.pointer;
+    entries[loop].tag = nodes[loop]->data.value.tag;
+    entries[loop].reserved = 0;
+    offset += nodes[loop]->length + 1;
+  }
+  header.size = offset;
+
+  /* key offsets are 32-bit */
+  written = offset <= 0xffffffffu && (file = fopen(path, "wb")) != 0;
+  if (written)
+  {
+    written = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (written && tree->size) written = fwrite(entries, sizeof(frozen_map_entry), tree->size, file) == (size_t)tree->size;
+    for (loop = 0; written && loop < tree->size; loop++)
+    {
+      written = fwrite(nodes[loop]->storage, nodes[loop]->length + 1, 1, file) == 1;
+    }
+    if (fclose(file) != 0) written = 0;
+  }
+  free(nodes);
+  free(entries);
+  return written;
+}
+
+frozen_map* frozen_map_open(const char* path)
+{
+  frozen_map* new_map = (frozen_map*)malloc(sizeof(frozen_map));
+  const frozen_map_header* header;
+#ifdef _WIN32
+  LARGE_INTEGER size;
+#else
+  struct stat status;
+  void* base;
+  int file;
+#endif
+
+  memset(new_map, 0, sizeof(frozen_map));
+#ifdef _WIN32
+  new_map->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+  if (new_map->file != INVALID_HANDLE_VALUE && GetFileSizeEx(new_map->file, &size) && size.QuadPart >= (LONGLONG)sizeof(frozen_map_header))
+  {
+    new_map->size = (size_t)size.QuadPart;
+    new_map->mapping = CreateFileMappingA(new_map->file, 0, PAGE_READONLY, 0, 0, 0);
+    if (new_map->mapping) new_map->base = (const unsigned char*)MapViewOfFile(new_map->mapping, FILE_MAP_READ, 0, 0, 0);
+  }
+#else
+  if ((file = open(path, O_RDONLY)) >= 0)
+  {
+    if (fstat(file, &status) == 0 && status.st_size >= (off_t)sizeof(frozen_map_header))
+    {
+      new_map->size = (size_t)status.st_size;
+      base = mmap(0, new_map->size, PROT_READ, MAP_SHARED, file, 0);
+      if (base != MAP_FAILED) new_map->base = (const unsigned char*)base;
+    }
+    /* mapping stays valid after descriptor is closed */
+    close(file);
+  }
+#endif
+
+  header = (const frozen_map_header*)new_map->base;
+  if (!header || memcmp(header->magic, FROZEN_MAP_MAGIC, sizeof(FROZEN_MAP_MAGIC)) != 0 ||
+      header->version != FROZEN_MAP_VERSION || header->size != new_map->size || header->entries % sizeof(uint64_t) != 0 ||
+      header->entries + (uint64_t)header->count * sizeof(frozen_map_entry) > header->size ||
+      !frozen_map_validate(new_map->base, header))
+  {
+    frozen_map_unmap(new_map);
+    free(new_map);
+    return 0;
+  }
+  new_map->entries = (const frozen_map_entry*)(new_map->base + header->entries);
+  new_map->count = (int)header->count;
+  return new_map;
+}
+
+void frozen_map_close(frozen_map* map_)
+{
+  frozen_map_unmap(map_);
+  free(map_);
+}
+
+int frozen_map_size(const frozen_map* map_)
+{
+  return map_->count;
+}
+
+int frozen_map_search(const frozen_map* map_, const char* key, generic* value)
+{
+  const frozen_map_entry* entry;
+  int length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+  int index = 0;
+  int comparison;
+
+  while (index < map_->count)
+  {
+    entry = &map_->entries[index];
+    /* same comparison as map, prefixes settle it unless both keys are longer */
+    if (prefix != entry->prefix) comparison = prefix < entry->prefix ? -1 : 1;
+    else if (length < 8 || entry->length < 8) comparison = 0;
+    else comparison = strcmp(key + 8, (const char*)map_->base + entry->key + 8);
+
+    if (comparison == 0)
+    {
+      value->pointer = (void*)(uintptr_t)entry->payload;
+      value->tag = entry->tag;
+      return 1;
+    }
+    index = 2 * index + (comparison < 0 ? 1 : 2);
+  }
+  return 0;
+}
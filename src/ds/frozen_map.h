@@ -0,0 +1,89 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  read-only memory-mapped image of a map
+*/
+
+#ifndef __VISUEM_FROZEN_MAP_H__
+#define __VISUEM_FROZEN_MAP_H__
+
+#include "generic.h"
+#include "map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief frozen map
+   * a file written by map_freeze, mapped into memory and searched in place. entries 
+   * are laid out in breadth-first (eytzinger) order of a complete binary search tree, 
+   * so the first levels of every search share a few cache lines. keys are stored after
+   * entries and referred to by file offsets, so the image doesn't depend on where it's
+   * mapped. nothing is deserialized and nothing is allocated per entry.
+   *
+   * values are stored as opaque 64-bit payloads: value pointers of a frozen map are
+   * only meaningful if they encode integers or offsets rather than addresses.
+   */
+  typedef struct frozen_map_ frozen_map;
+
+  /** 
+   * /brief writes a map into a file as a frozen map image
+   * /return 1 on success, 0 if file couldn't be written.
+   */
+  extern int map_freeze(map* tree, const char* path);
+
+  /** 
+   * /brief maps a frozen map image into memory
+   * /return a null pointer if file can't be mapped or isn't a frozen map image.
+   */
+  extern frozen_map* frozen_map_open(const char* path);
+
+  /** 
+   * /brief unmaps a frozen map. values found in it become invalid.
+   */
+  extern void frozen_map_close(frozen_map* map_);
+
+  /** 
+   * /brief number of keys in a frozen map
+   */
+  extern int frozen_map_size(const frozen_map* map_);
+
+  /** 
+   * /brief searches a frozen map with a specific key 
+   * /return 1 and value of key through value, 0 if key is not found.
+   */
+  extern int frozen_map_search(const frozen_map* map_, const char* key, generic* value);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
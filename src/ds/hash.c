@@ -0,0 +1,45 @@
+#include "hash.h"
+#include <string.h> /* strlen, memcpy */
+
+#define HASH_MULTIPLIER   (0xc6a4a7935bd1e995ULL)
+#define HASH_SHIFT        47
+
+unsigned long long hash_bytes(const void* data, const size_t length, const unsigned long long seed)
+{
+  const unsigned char* bytes = (const unsigned char*)data;
+  const unsigned char* end = bytes + (length & ~(size_t)7);
+  unsigned long long hash = seed ^ (length * HASH_MULTIPLIER);
+  unsigned long long word;
+
+  /* murmur64a, reading 8 bytes at a time */
+  while (bytes != end)
+  {
+    memcpy(&word, bytes, sizeof(word));
+    word *= HASH_MULTIPLIER;
+    word ^= word >> HASH_SHIFT;
+    word *= HASH_MULTIPLIER;
+    hash ^= word;
+    hash *= HASH_MULTIPLIER;
+    bytes += 8;
+  }
+  switch (length & 7)
+  {
+  case 7: hash ^= (unsigned long long)bytes[6] << 48; /* fall through */
+  case 6: hash ^= (unsigned long long)bytes[5] << 40; /* fall through */
+  case 5: hash ^= (unsigned long long)bytes[4] << 32; /* fall through */
+  case 4: hash ^= (unsigned long long)bytes[3] << 24; /* fall through */
+  case 3: hash ^= (unsigned long long)bytes[2] << 16; /* fall through */
+  case 2: hash ^= (unsigned long long)bytes[1] << 8; /* fall through */
+  case 1: hash ^= (unsigned long long)bytes[0];
+    hash *= HASH_MULTIPLIER;
+  }
+  hash ^= hash >> HASH_SHIFT;
+  hash *= HASH_MULTIPLIER;
+  hash ^= hash >> HASH_SHIFT;
+  return hash;
+}
+
+unsigned long long hash_string(const char* key)
+{
+  return hash_bytes(key, strlen(key), 0);
+}
@@ -0,0 +1,288 @@
+#include "hashmap.h"
+#include "hash.h"
+#include <string.h> /* strcmp */
+#include <memory.h> /* memset */
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * control byte values
+ */
+#define HASHMAP_EMPTY     ((signed char)-128)
+#define HASHMAP_DELETED   ((signed char)-2)
+
+/**
+ * slot is occupied by a key
+ */
+#define hashmap_is_full(c) ((c) >= 0)
+
+/**
+ * upper bits of a hash select the group to probe first, lower 7 bits go into control bytes
+ */
+#define hashmap_h1(h) ((h) >> 7)
+#define hashmap_h2(h) ((signed char)((h) & 0x7f))
+
+/**
+ * maximum number of keys a capacity can take (7/8 load factor)
+ */
+#define hashmap_max_load(c) ((c) - (c) / 8)
+
+/**
+ * bit mask of slots in a group whose control byte equals to a value
+ */
+unsigned int hashmap_group_match(const signed char* group, const signed char value);
+unsigned int hashmap_group_match(const signed char* group, const signed char value)
+{
+#ifdef __SSE2__
+  __m128i bytes = _mm_loadu_si128((const __m128i*)group);
+  return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+#else
+  unsigned int mask = 0;
+  int loop;
+
+  for (loop = 0; loop < HASHMAP_GROUP_SIZE; loop++)
+  {
+    if (group[loop] == value) mask |= 1u << loop;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * bit mask of slots in a group which are empty or deleted
+ */
+unsigned int hashmap_group_match_free(const signed char* group);
+unsigned int hashmap_group_match_free(const signed char* group)
+{
+#ifdef __SSE2__
+  __m128i bytes = _mm_loadu_si128((const __m128i*)group);
+  return (unsigned int)_mm_movemask_epi8(bytes);
+#else
+  unsigned int mask = 0;
+  int loop;
+
+  for (loop = 0; loop < HASHMAP_GROUP_SIZE; loop++)
+  {
+    if (!hashmap_is_full(group[loop])) mask |= 1u << loop;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * index of the lowest set bit of a non zero mask
+ */
+int hashmap_lowest_bit(unsigned int mask);
+int hashmap_lowest_bit(unsigned int mask)
+{
+#if defined(__GNUC__)
+  return __builtin_ctz(mask);
+#else
+  int index = 0;
+
+  while (!(mask & 1u))
+  {
+    mask >>= 1;
+    ++index;
+  }
+  return index;
+#endif
+}
+
+/**
+ * finds slot of a key
+ * returns -1 if key is not found
+ */
+int hashmap_find(hashmap* map_, const char* key, const unsigned long long hash);
+int hashmap_find(hashmap* map_, const char* key, const unsigned long long hash)
+{
+  const int groups = map_->capacity / HASHMAP_GROUP_SIZE;
+  const signed char h2 = hashmap_h2(hash);
+  int group = (int)(hashmap_h1(hash) & (unsigned long long)(groups - 1));
+  int step = 0;
+  int slot;
+  unsigned int mask;
+  signed char* control;
+
+  if (!map_->capacity) return -1;
+  for (;;)
+  {
+    control = map_->control + group * HASHMAP_GROUP_SIZE;
+    mask = hashmap_group_match(control, h2);
+    while (mask)
+    {
+      slot = group * HASHMAP_GROUP_SIZE + hashmap_lowest_bit(mask);
+      if (strcmp(key, map_->slots[slot].key) == 0) return slot;
+      mask &= mask - 1;
+    }
+    /* an empty slot ends the probe sequence */
+    if (hashmap_group_match(control, HASHMAP_EMPTY)) return -1;
+    /* triangular probing visits every group once */
+    ++step;
+    if (step == groups) return -1;
+    group = (group + step) & (groups - 1);
+  }
+}
+
+/**
+ * finds a free slot for a hash
+ */
+int hashmap_find_free(hashmap* map_, const unsigned long long hash);
+int hashmap_find_free(hashmap* map_, const unsigned long long hash)
+{
+  const int groups = map_->capacity / HASHMAP_GROUP_SIZE;
+  int group = (int)(hashmap_h1(hash) & (unsigned long long)(groups - 1));
+  int step = 0;
+  unsigned int mask;
+
+  for (;;)
+  {
+    mask = hashmap_group_match_free(map_->control + group * HASHMAP_GROUP_SIZE);
+    if (mask) return group * HASHMAP_GROUP_SIZE + hashmap_lowest_bit(mask);
+    ++step;
+    group = (group + step) & (groups - 1);
+  }
+}
+
+/**
+ * reallocates slots to a given capacity and reinserts all keys, dropping deleted markers
+ */
+void hashmap_rehash(hashmap* map_, const int capacity);
+void hashmap_rehash(hashmap* map_, const int capacity)
+{
+  signed char* control = map_->control;
+  meta* slots = map_->slots;
+  int old_capacity = map_->capacity;
+  int loop;
+  int slot;
+  unsigned long long hash;
+
+  map_->control = (signed char*)allocator_allocate(map_->allocator_, capacity * sizeof(signed char));
+  map_->slots = (meta*)allocator_allocate(map_->allocator_, capacity * sizeof(meta));
+  memset(map_->control, HASHMAP_EMPTY, capacity * sizeof(signed char));
+  map_->capacity = capacity;
+  map_->growth_left = hashmap_max_load(capacity) - map_->size;
+  for (loop = 0; loop < old_capacity; loop++)
+  {
+    if (!hashmap_is_full(control[loop])) continue;
+    hash = hash_string(slots[loop].key);
+    slot = hashmap_find_free(map_, hash);
+    map_->control[slot] = hashmap_h2(hash);
+    map_->slots[slot] = slots[loop];
+  }
+  if (control)
+  {
+    allocator_release(map_->allocator_, control);
+    allocator_release(map_->allocator_, slots);
+  }
+}
+
+hashmap* hashmap_alloc()
+{
+  return hashmap_alloc_with(0);
+}
+
+hashmap* hashmap_alloc_with(const allocator* allocator_)
+{
+  hashmap* new_map;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_map = (hashmap*)allocator_allocate(allocator_, sizeof(hashmap));
+  memset(new_map, 0, sizeof(hashmap));
+  new_map->allocator_ = allocator_;
+  return new_map;
+}
+
+void hashmap_free(hashmap* map_)
+{
+  int loop;
+
+  if (map_->control)
+  {
+    for (loop = 0; loop < map_->capacity; loop++)
+    {
+      if (hashmap_is_full(map_->control[loop])) allocator_release(map_->allocator_, map_->slots[loop].key);
+    }
+    allocator_release(map_->allocator_, map_->control);
+    allocator_release(map_->allocator_, map_->slots);
+  }
+  allocator_release(map_->allocator_, map_);
+}
+
+void hashmap_insert(hashmap* map_, const char* key, void* data, const int tag)
+{
+  const unsigned long long hash = hash_string(key);
+  const size_t length = strlen(key) + 1;
+  int slot;
+
+  if (hashmap_find(map_, key, hash) >= 0) return;
+  if (map_->growth_left <= 0)
+  {
+    /* grow if map is more than half full, otherwise just clean deleted markers up */
+    if (map_->size * 2 >= hashmap_max_load(map_->capacity)) hashmap_rehash(map_, map_->capacity ? map_->capacity * 2 : HASHMAP_GROUP_SIZE);
+    else hashmap_rehash(map_, map_->capacity);
+  }
+  slot = hashmap_find_free(map_, hash);
+  if (map_->control[slot] == HASHMAP_EMPTY) --(map_->growth_left);
+  map_->control[slot] = hashmap_h2(hash);
+  map_->slots[slot].key = (char*)allocator_allocate(map_->allocator_, length);
+  memcpy(map_->slots[slot].key, key, length);
+  map_->slots[slot].value.pointer = data;
+  map_->slots[slot].value.tag = tag;
+  ++(map_->size);
+}
+
+generic* hashmap_search(hashmap* map_, const char* key)
+{
+  int slot = hashmap_find(map_, key, hash_string(key));
+
+  if (slot < 0) return 0;
+  return &map_->slots[slot].value;
+}
+
+int hashmap_remove(hashmap* map_, const char* key)
+{
+  int slot = hashmap_find(map_, key, hash_string(key));
+  signed char* group;
+
+  if (slot < 0) return 0;
+  allocator_release(map_->allocator_, map_->slots[slot].key);
+  map_->slots[slot].key = 0;
+  /* probes never pass a group which still has an empty slot, so the slot can become empty again */
+  group = map_->control + (slot / HASHMAP_GROUP_SIZE) * HASHMAP_GROUP_SIZE;
+  if (hashmap_group_match(group, HASHMAP_EMPTY))
+  {
+    map_->control[slot] = HASHMAP_EMPTY;
+    ++(map_->growth_left);
+  }
+  else
+  {
+    map_->control[slot] = HASHMAP_DELETED;
+  }
+  --(map_->size);
+  return 1;
+}
+
+meta* hashmap_first(hashmap* map_)
+{
+  int loop;
+
+  for (loop = 0; loop < map_->capacity; loop++)
+  {
+    if (hashmap_is_full(map_->control[loop])) return &map_->slots[loop];
+  }
+  return 0;
+}
+
+meta* hashmap_next(hashmap* map_, meta* current)
+{
+  int loop;
+
+  for (loop = (int)(current - map_->slots) + 1; loop < map_->capacity; loop++)
+  {
+    if (hashmap_is_full(map_->control[loop])) return &map_->slots[loop];
+  }
+  return 0;
+}
@@ -0,0 +1,118 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  open addressing hash map with string keys
+*/
+
+#ifndef __VISUEM_HASHMAP_H__
+#define __VISUEM_HASHMAP_H__
+
+#include "generic.h"
+#include "allocator.h"
+#include "map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief number of slots probed together
+   */
+#define HASHMAP_GROUP_SIZE 16
+
+  /** 
+   * /brief open addressing hash map
+   * slots are kept in a flat array with a parallel array of control bytes. a control 
+   * byte is either empty, deleted or 7 bits of the hash of the key in its slot. lookups
+   * compare a whole group of control bytes at once (with sse2 when available) and only
+   * compare keys of the slots whose control byte matches.
+   */
+  typedef struct 
+  {
+    signed char*          control;      /* control bytes, one per slot */
+    meta*                 slots;        /* key-value pairs */
+    int                   capacity;     /* number of slots, a power of two multiple of group size */
+    int                   size;         /* number of keys */
+    int                   growth_left;  /* number of insertions before rehash */
+    const allocator*      allocator_;   /* allocator of map, its arrays and keys */
+  } hashmap;
+
+  /** 
+   * /brief allocates a hash map
+   */
+  extern hashmap* hashmap_alloc();
+
+  /** 
+   * /brief allocates a hash map which gets its memory from a given allocator
+   */
+  extern hashmap* hashmap_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes a hash map
+   * not responsible for deallocation of data within nodes
+   */    
+  extern void hashmap_free(hashmap* map_);
+
+  /** 
+   * /brief inserts a key-value pair into hash map. 
+   * key is copied. nothing is changed if key already exists.
+   */
+  extern void hashmap_insert(hashmap* map_, const char* key, void* data, const int tag);
+
+  /** 
+   * /brief searches a hash map with a specific key 
+   *
+   * /return pointer to element related with given key.
+   *         a null pointer if key is not found.
+   */
+  extern generic* hashmap_search(hashmap* map_, const char* key);
+
+  /** 
+   * /brief removes a key from hash map
+   * /return 1 if key is removed, 0 if it is not found.
+   */
+  extern int hashmap_remove(hashmap* map_, const char* key);
+
+  /** 
+   * /brief first key-value pair of hash map in slot order
+   * /return a null pointer if map is empty.
+   */
+  extern meta* hashmap_first(hashmap* map_);
+
+  /** 
+   * /brief key-value pair which comes after a given one in slot order
+   * /return a null pointer if there are no more pairs.
+   */
+  extern meta* hashmap_next(hashmap* map_, meta* current);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,183 @@
+#include "interval_tree.h"
+#include "rbtree.h"
+#include <memory.h> /* memset */
+
+/**
+ * largest end in a subtree, given it is not null
+ */
+#define interval_node_max_end(n, m) ((n) != 0 && (n)->max_end > (m) ? (n)->max_end : (m))
+
+/**
+ * recomputes largest end of a node's subtree from its children
+ */
+#define interval_node_update(t, n) do \
+{ \
+  (n)->max_end = interval_node_max_end((n)->left, (n)->end); \
+  (n)->max_end = interval_node_max_end((n)->right, (n)->max_end); \
+} while (0)
+
+RBTREE_DEFINE(interval_tree, interval_tree, interval_node, interval_node_update)
+
+/**
+ * does a node overlap [start, end)
+ */
+#define interval_node_overlaps(n, s, e) ((n)->start < (e) && (s) < (n)->end)
+
+/**
+ * deletes a node with its children.
+ */
+void interval_node_destroy_with_children(interval_tree* tree, interval_node* node);
+void interval_node_destroy_with_children(interval_tree* tree, interval_node* node)
+{
+  if (node->right) interval_node_destroy_with_children(tree, node->right);
+  if (node->left) interval_node_destroy_with_children(tree, node->left);
+  allocator_release(tree->allocator_, node);
+}
+
+/**
+ * visits overlapping intervals of a subtree in order. subtrees ending before the
+ * range are skipped, so are right subtrees of nodes starting after it.
+ */
+int interval_node_overlaps_all(interval_node* node, const long long start, const long long end, interval_visitor visitor, void* context);
+int interval_node_overlaps_all(interval_node* node, const long long start, const long long end, interval_visitor visitor, void* context)
+{
+  int result;
+
+  if (node == 0 || node->max_end <= start) return 0;
+  if ((result = interval_node_overlaps_all(node->left, start, end, visitor, context)) != 0) return result;
+  if (node->start >= end) return 0;
+  if (interval_node_overlaps(node, start, end) && (result = visitor(context, node)) != 0) return result;
+  return interval_node_overlaps_all(node->right, start, end, visitor, context);
+}
+
+interval_tree* interval_tree_alloc()
+{
+  return interval_tree_alloc_with(0);
+}
+
+interval_tree* interval_tree_alloc_with(const allocator* allocator_)
+{
+  interval_tree* new_tree;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_tree = (interval_tree*)allocator_allocate(allocator_, sizeof(interval_tree));
+  memset(new_tree, 0, sizeof(interval_tree));
+  new_tree->allocator_ = allocator_;
+  return new_tree;
+}
+
+void interval_tree_free(interval_tree* tree)
+{
+  if (tree->root) interval_node_destroy_with_children(tree, tree->root);
+  allocator_release(tree->allocator_, tree);
+}
+
+interval_node* interval_tree_insert(interval_tree* tree, const long long start, const long long end, void* data, const int tag)
+{
+  interval_node* node = (interval_node*)allocator_allocate(tree->allocator_, sizeof(interval_node));
+  interval_node* parent = 0;
+  interval_node* iterator = tree->root;
+
+  memset(node, 0, sizeof(interval_node));
+  node->start = start;
+  node->end = end;
+  node->max_end = end;
+  node->value.pointer = data;
+  node->value.tag = tag;
+  node->color = RB_RED;
+
+  /* max ends along the path grow on the way down, equal starts go right */
+  while (iterator != 0) 
+  {
+    if (iterator->max_end < end) iterator->max_end = end;
+    parent = iterator;
+    iterator = start < iterator->start ? iterator->left : iterator->right;
+  }
+  if (parent == 0) tree_set_root(tree, node);
+  else if (start < parent->start) rbnode_set_left_child(parent, node);
+  else rbnode_set_right_child(parent, node);
+
+  tree->size++;
+  interval_tree_insert_balance(tree, node);
+  return node;
+}
+
+void interval_tree_remove(interval_tree* tree, interval_node* node)
+{
+  interval_node* successor;
+  interval_node* child;
+  interval_node* parent;
+  interval_node* iterator;
+  int color = node->color;
+
+  if (node->left == 0) 
+  {
+    child = node->right;
+    parent = node->parent;
+    interval_tree_transplant(tree, node, child);
+  }
+  else if (node->right == 0) 
+  {
+    child = node->left;
+    parent = node->parent;
+    interval_tree_transplant(tree, node, child);
+  }
+  else 
+  {
+    /* successor takes the place of the node, its own place is taken by its right child */
+    successor = node->right;
+    while (successor->left) successor = successor->left;
+    color = successor->color;
+    child = successor->right;
+    if (successor->parent == node) 
+    {
+      parent = successor;
+    }
+    else 
+    {
+      parent = successor->parent;
+      interval_tree_transplant(tree, successor, child);
+      rbnode_set_right_child(successor, node->right);
+    }
+    interval_tree_transplant(tree, node, successor);
+    rbnode_set_left_child(successor, node->left);
+    successor->color = node->color;
+  }
+
+  /* max ends are fixed up before rebalancing, rotations rely on children being right */
+  for (iterator = parent; iterator; iterator = iterator->parent) interval_node_update(tree, iterator);
+  if (color == RB_BLACK && tree->root) interval_tree_remove_balance(tree, child, parent);
+  allocator_release(tree->allocator_, node);
+  tree->size--;
+}
+
+int interval_tree_overlaps(interval_tree* tree, const long long start, const long long end, interval_visitor visitor, void* context)
+{
+  return interval_node_overlaps_all(tree->root, start, end, visitor, context);
+}
+
+int interval_tree_stab(interval_tree* tree, const long long point, interval_visitor visitor, void* context)
+{
+  return interval_node_overlaps_all(tree->root, point, point + 1, visitor, context);
+}
+
+interval_node* interval_tree_first_overlap(interval_tree* tree, const long long start, const long long end)
+{
+  interval_node* iterator = tree->root;
+
+  /* leftmost overlap: go left whenever left subtree reaches into the range */
+  while (iterator != 0 && iterator->max_end > start) 
+  {
+    if (iterator->left && iterator->left->max_end > start) 
+    {
+      iterator = iterator->left;
+    }
+    else 
+    {
+      if (iterator->start >= end) return 0;
+      if (interval_node_overlaps(iterator, start, end)) return iterator;
+      iterator = iterator->right;
+    }
+  }
+  return 0;
+}
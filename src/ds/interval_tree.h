@@ -0,0 +1,127 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  red-black tree based interval tree
+*/
+
+#ifndef __VISUEM_INTERVAL_TREE_H__
+#define __VISUEM_INTERVAL_TREE_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief interval tree node holding a half open interval [start, end)
+   * nodes are ordered by start. max_end is the largest end within the subtree of the
+   * node, which lets queries skip subtrees that end before the queried range.
+   */
+  typedef struct interval_node_ 
+  {
+    int                   color;
+    long long             start;
+    long long             end;
+    long long             max_end;      /* largest end in subtree */
+    struct interval_node_ * left;
+    struct interval_node_ * right;
+    struct interval_node_ * parent;
+    generic               value;
+  } interval_node;
+
+  /** 
+   * /brief interval tree. same interval may be inserted more than once.
+   */
+  typedef struct 
+  {
+    interval_node*        root;
+    int                   size;
+    const allocator*      allocator_;
+  } interval_tree;
+
+  /** 
+   * /brief callback of interval queries, returning non zero stops the query
+   */
+  typedef int (*interval_visitor)(void* context, interval_node* node);
+
+  /** 
+   * /brief allocates an interval tree
+   */
+  extern interval_tree* interval_tree_alloc();
+
+  /** 
+   * /brief allocates an interval tree which gets its memory from a given allocator
+   */
+  extern interval_tree* interval_tree_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes an interval tree
+   * not responsible for deallocation of data within nodes
+   */    
+  extern void interval_tree_free(interval_tree* tree);
+
+  /** 
+   * /brief inserts an interval [start, end) into tree
+   * /return node of interval, which stays valid until it is removed.
+   */
+  extern interval_node* interval_tree_insert(interval_tree* tree, const long long start, const long long end, void* data, const int tag);
+
+  /** 
+   * /brief removes a node from tree and deletes it
+   * not responsible for deallocation of data within node
+   */
+  extern void interval_tree_remove(interval_tree* tree, interval_node* node);
+
+  /** 
+   * /brief visits every interval overlapping [start, end) in order of start, in 
+   * O(log n + k) for k overlapping intervals.
+   * /return value returned by the visitor which stopped the query, 0 if none did.
+   */
+  extern int interval_tree_overlaps(interval_tree* tree, const long long start, const long long end, interval_visitor visitor, void* context);
+
+  /** 
+   * /brief visits every interval containing a point in order of start
+   * /return value returned by the visitor which stopped the query, 0 if none did.
+   */
+  extern int interval_tree_stab(interval_tree* tree, const long long point, interval_visitor visitor, void* context);
+
+  /** 
+   * /brief interval with the smallest start overlapping [start, end)
+   * /return a null pointer if no interval overlaps.
+   */
+  extern interval_node* interval_tree_first_overlap(interval_tree* tree, const long long start, const long long end);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
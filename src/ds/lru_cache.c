@@ -0,0 +1,172 @@
+#include "lru_cache.h"
+#include <string.h> /* strlen */
+#include <memory.h> /* memset */
+#include <stddef.h> /* offsetof */
+
+/**
+ * unlinks an entry from recency list
+ */
+void lru_cache_unlink(lru_cache* cache, lru_cache_entry* entry);
+void lru_cache_unlink(lru_cache* cache, lru_cache_entry* entry)
+{
+  if (entry->newer) entry->newer->older = entry->older;
+  else cache->newest = entry->older;
+  if (entry->older) entry->older->newer = entry->newer;
+  else cache->oldest = entry->newer;
+}
+
+/**
+ * links an entry to the front of recency list
+ */
+void lru_cache_link(lru_cache* cache, lru_cache_entry* entry);
+void lru_cache_link(lru_cache* cache, lru_cache_entry* entry)
+{
+  entry->newer = 0;
+  entry->older = cache->newest;
+  if (cache->newest) cache->newest->newer = entry;
+  else cache->oldest = entry;
+  cache->newest = entry;
+}
+
+/**
+ * entry of a key, a null pointer if key is not cached
+ */
+lru_cache_entry* lru_cache_find(lru_cache* cache, const char* key);
+lru_cache_entry* lru_cache_find(lru_cache* cache, const char* key)
+{
+  generic* slot = hashmap_search(cache->index, key);
+
+  return slot ? (lru_cache_entry*)slot->pointer : 0;
+}
+
+/**
+ * takes an entry out of cache and hands its value to release callback
+ */
+void lru_cache_drop(lru_cache* cache, lru_cache_entry* entry);
+void lru_cache_drop(lru_cache* cache, lru_cache_entry* entry)
+{
+  lru_cache_unlink(cache, entry);
+  hashmap_remove(cache->index, entry->key);
+  cache->cost -= entry->cost;
+  --(cache->size);
+  if (cache->release) cache->release(cache->context, entry->key, &entry->value);
+  allocator_release(cache->allocator_, entry);
+}
+
+/**
+ * evicts least recently used entries until total cost fits capacity. keep is never evicted.
+ */
+void lru_cache_evict(lru_cache* cache, const lru_cache_entry* keep);
+void lru_cache_evict(lru_cache* cache, const lru_cache_entry* keep)
+{
+  while (cache->cost > cache->capacity && cache->oldest && cache->oldest != keep)
+  {
+    lru_cache_drop(cache, cache->oldest);
+    ++(cache->evictions);
+  }
+}
+
+lru_cache* lru_cache_alloc(const size_t capacity, lru_cache_callback release, void* context)
+{
+  return lru_cache_alloc_with(0, capacity, release, context);
+}
+
+lru_cache* lru_cache_alloc_with(const allocator* allocator_, const size_t capacity, lru_cache_callback release, void* context)
+{
+  lru_cache* new_cache;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_cache = (lru_cache*)allocator_allocate(allocator_, sizeof(lru_cache));
+  memset(new_cache, 0, sizeof(lru_cache));
+  new_cache->index = hashmap_alloc_with(allocator_);
+  new_cache->capacity = capacity;
+  new_cache->release = release;
+  new_cache->context = context;
+  new_cache->allocator_ = allocator_;
+  return new_cache;
+}
+
+void lru_cache_free(lru_cache* cache)
+{
+  lru_cache_entry* entry = cache->newest;
+  lru_cache_entry* older;
+
+  /* index goes away as a whole, entries are released without touching it */
+  while (entry)
+  {
+    older = entry->older;
+    if (cache->release) cache->release(cache->context, entry->key, &entry->value);
+    allocator_release(cache->allocator_, entry);
+    entry = older;
+  }
+  hashmap_free(cache->index);
+  allocator_release(cache->allocator_, cache);
+}
+
+generic* lru_cache_get(lru_cache* cache, const char* key)
+{
+  lru_cache_entry* entry = lru_cache_find(cache, key);
+
+  if (!entry)
+  {
+    ++(cache->misses);
+    return 0;
+  }
+  ++(cache->hits);
+  if (entry != cache->newest)
+  {
+    lru_cache_unlink(cache, entry);
+    lru_cache_link(cache, entry);
+  }
+  return &entry->value;
+}
+
+generic* lru_cache_peek(lru_cache* cache, const char* key)
+{
+  lru_cache_entry* entry = lru_cache_find(cache, key);
+
+  return entry ? &entry->value : 0;
+}
+
+void lru_cache_put(lru_cache* cache, const char* key, void* data, const int tag, const size_t cost)
+{
+  lru_cache_entry* entry = lru_cache_find(cache, key);
+  size_t length;
+
+  if (entry)
+  {
+    /* replaced value leaves cache */
+    if (cache->release) cache->release(cache->context, entry->key, &entry->value);
+    lru_cache_unlink(cache, entry);
+    cache->cost -= entry->cost;
+  }
+  else
+  {
+    length = strlen(key) + 1;
+    entry = (lru_cache_entry*)allocator_allocate(cache->allocator_, offsetof(lru_cache_entry, key) + length);
+    memcpy(entry->key, key, length);
+    hashmap_insert(cache->index, key, entry, 0);
+    ++(cache->size);
+  }
+  entry->value.pointer = data;
+  entry->value.tag = tag;
+  entry->cost = cost;
+  cache->cost += cost;
+  lru_cache_link(cache, entry);
+  lru_cache_evict(cache, entry);
+}
+
+int lru_cache_remove(lru_cache* cache, const char* key)
+{
+  lru_cache_entry* entry = lru_cache_find(cache, key);
+
+  if (!entry) return 0;
+  lru_cache_drop(cache, entry);
+  return 1;
+}
+
+void lru_cache_set_capacity(lru_cache* cache, const size_t capacity)
+{
+  cache->capacity = capacity;
+  lru_cache_evict(cache, 0);
+}
@@ -0,0 +1,136 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  size bounded least recently used cache
+*/
+
+#ifndef __VISUEM_LRU_CACHE_H__
+#define __VISUEM_LRU_CACHE_H__
+
+#include <stddef.h> /* size_t */
+#include "generic.h"
+#include "allocator.h"
+#include "hashmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief called with every value which leaves a cache, be it evicted, replaced, 
+   * removed or dropped when cache is freed. owner of values releases them here.
+   */
+  typedef void (*lru_cache_callback)(void* context, const char* key, generic* value);
+
+  /** 
+   * /brief cache entry, linked into recency list of cache
+   */
+  typedef struct lru_cache_entry_ 
+  {
+    struct lru_cache_entry_* newer;
+    struct lru_cache_entry_* older;
+    generic               value;
+    size_t                cost;         /* share of entry in capacity of cache */
+    char                  key[1];       /* key, extends beyond the end of the structure */
+  } lru_cache_entry;
+
+  /** 
+   * /brief least recently used cache
+   * keys are indexed by a hash map whose values point to entries, entries are linked
+   * into a list from most to least recently used. every entry has a cost given by its
+   * owner (eg. size of decoded image in bytes), least recently used entries are evicted
+   * while total cost exceeds capacity.
+   */
+  typedef struct 
+  {
+    hashmap*              index;        /* key to entry */
+    lru_cache_entry*      newest;       /* most recently used entry */
+    lru_cache_entry*      oldest;       /* least recently used entry, next to be evicted */
+    size_t                capacity;     /* limit of total cost */
+    size_t                cost;         /* total cost of entries */
+    int                   size;         /* number of entries */
+    unsigned long long    hits;         /* number of lookups which found their key */
+    unsigned long long    misses;       /* number of lookups which didn't */
+    unsigned long long    evictions;    /* number of entries evicted to make room */
+    lru_cache_callback    release;      /* called for leaving values, may be null */
+    void*                 context;      /* passed to release */
+    const allocator*      allocator_;
+  } lru_cache;
+
+  /** 
+   * /brief allocates a cache with given capacity
+   */
+  extern lru_cache* lru_cache_alloc(const size_t capacity, lru_cache_callback release, void* context);
+
+  /** 
+   * /brief allocates a cache which gets its memory from a given allocator
+   */
+  extern lru_cache* lru_cache_alloc_with(const allocator* allocator_, const size_t capacity, lru_cache_callback release, void* context);
+
+  /** 
+   * /brief deletes a cache, passing all remaining values to release callback
+   */    
+  extern void lru_cache_free(lru_cache* cache);
+
+  /** 
+   * /brief looks a key up and marks it most recently used
+   * /return pointer to value of key, a null pointer if key is not cached.
+   */
+  extern generic* lru_cache_get(lru_cache* cache, const char* key);
+
+  /** 
+   * /brief looks a key up without changing recency or counters
+   * /return pointer to value of key, a null pointer if key is not cached.
+   */
+  extern generic* lru_cache_peek(lru_cache* cache, const char* key);
+
+  /** 
+   * /brief caches a value under a key as most recently used, replacing the previous 
+   * value of key if there is one. least recently used entries are then evicted until
+   * total cost fits capacity, an entry is never evicted by its own put though.
+   */
+  extern void lru_cache_put(lru_cache* cache, const char* key, void* data, const int tag, const size_t cost);
+
+  /** 
+   * /brief removes a key from cache
+   * /return 1 if key is removed, 0 if it is not cached.
+   */
+  extern int lru_cache_remove(lru_cache* cache, const char* key);
+
+  /** 
+   * /brief changes capacity of a cache, evicting entries if it shrinks
+   */
+  extern void lru_cache_set_capacity(lru_cache* cache, const size_t capacity);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
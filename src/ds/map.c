@@ -1,319 +1,646 @@
-#include "map.h"
-#include <string.h> /* strcmp */
-#include <stdlib.h> /* malloc */
-
-/**
- * node colours
- */
-#define RB_BLACK        0
-#define RB_RED          1
-
-/** 
- * set the node's right child 
- */
-#define rbnode_set_right_child(n, r) do \
-{ \
-  (n)->right = (r); \
-  if ((r) != 0) (r)->parent = (n); \
-} while (0)
-
-/**
- * set the node's left child 
- */
-#define rbnode_set_left_child(n, l) do \
-{ \
-  (n)->left = (l); \
-  if ((l) != 0) (l)->parent = (n); \
-} while (0)
-
-
-/** 
- * set tree's root node 
- */
-#define tree_set_root(t, n) do \
-{ \
-  t->root = (n); \
-  if ((n) != 0) { \
-  (n)->parent = 0; \
-  (n)->color = RB_BLACK; \
-  } \
-} while (0)
-
-/** 
- * is node a left child of its parent 
- */
-#define rbnode_is_left_child(n) ((n)->parent != 0 && (n)->parent->left == (n))
-
-/** 
- * is node a right child of its parent 
- */
-#define rbnode_is_right_child(n) ((n)->parent != 0 && (n)->parent->right == (n))
-
-/** 
- * is node a root node 
- */
-#define rbnode_is_root(n) ((n)->parent == 0)
-
-/** 
- * is node a leaf node 
- */
-#define rbnode_is_leaf(n) ((n)->left == 0 && (n)->right == 0)
-
-/** 
- * is node a red node 
- */
-#define rbnode_is_red(n) ((n)->color == RB_RED)
-
-/** 
- * is node a black node 
- */
-#define rbnode_is_black(n) ((n)->color == RB_BLACK)
-
-/** 
- * node's right uncle (if its parent is a right child) 
- */
-#define rbnode_right_uncle(n) ((n)->parent->parent->right)
-
-/** 
- * node's left uncle (if its parent is a left child) 
- */
-#define rbnode_left_uncle(n) ((n)->parent->parent->left)
-
-/** 
- * node's grand parent node 
- */
-#define rbnode_grand_parent(n) ((n)->parent->parent)
-
-/** 
- * left rotate a node in a tree 
- */ 
-void map_left_rotate(map* tree, rbnode* node);
-void map_left_rotate(map* tree, rbnode* node) 
-{                               
-  rbnode* r;
-
-  r = node->right;         
-  rbnode_set_right_child(node, r->left);                                  
-  if (rbnode_is_root(node)) tree_set_root(tree, r);                             
-  else if (rbnode_is_right_child(node)) rbnode_set_right_child(node->parent, r);  
-  else rbnode_set_left_child(node->parent, r);                            
-  rbnode_set_left_child(r, node);               
-};
-
-/** 
- * right rotate a node in a tree 
- */ 
-void map_right_rotate(map* tree, rbnode* node);
-void map_right_rotate(map* tree, rbnode* node) 
-{ 
-  rbnode* l = node->left;
-
-  rbnode_set_left_child(node, l->right); 
-  if (rbnode_is_root(node)) tree_set_root(tree, l);
-  else if (rbnode_is_right_child(node)) rbnode_set_right_child(node->parent, l);
-  else rbnode_set_left_child(node->parent, l);
-  rbnode_set_right_child(l, node);
-}
-
-/**
- * create a new node from key-value pair 
- * returns a red-black tree node with specified key-value pair
- */ 
-rbnode* rbnode_create(const char* key, void* pointer, const int tag);
-rbnode* rbnode_create(const char* key, void* pointer, const int tag)
-{
-  rbnode* new_node = (rbnode*)malloc(sizeof(rbnode));
-
-  memset(new_node, 0, sizeof(rbnode));
-  new_node->data.key = (char*)malloc(sizeof(char) * (strlen(key) + 1));
-  strcpy(new_node->data.key, key);
-  new_node->data.value.pointer = pointer;
-  new_node->data.value.tag = tag,
-  new_node->color = RB_RED;
-  return new_node;
-}
-
-/** 
- * deletes a node.
- */ 
-void rbnode_destroy(rbnode* node);
-void rbnode_destroy(rbnode* node)
-{
-  if (node->data.key) free(node->data.key); 
-  free(node); /* hmm */
-}
-
-/**
- * deletes a node with its children.
- */
-void rbnode_destroy_with_children(rbnode* node);
-void rbnode_destroy_with_children(rbnode* node)
-{
-  if (node->right) rbnode_destroy_with_children(node->right);
-  if (node->left) rbnode_destroy_with_children(node->left);
-  rbnode_destroy(node);
-}
-
-/** 
- * balances map after an insertion.
- */
-void map_insert_balance(map* tree, rbnode* node);
-void map_insert_balance(map* tree, rbnode* node) 
-{
-  rbnode* uncle;
-
-  while (rbnode_is_root(node) == 0 && node->parent->color == RB_RED) 
-  {
-    if (rbnode_is_left_child(node->parent)) 
-    {
-      uncle = rbnode_right_uncle(node);
-      if (uncle != 0 && rbnode_is_red(uncle)) 
-      {
-        node->parent->color = RB_BLACK;
-        rbnode_grand_parent(node)->color = RB_RED;
-        uncle->color = RB_BLACK;
-        node = rbnode_grand_parent(node);
-      }
-      else 
-      {
-        if (rbnode_is_right_child(node)) 
-        {
-          node = node->parent;
-          map_left_rotate(tree, node);
-        }
-        node->parent->color = RB_BLACK;
-        rbnode_grand_parent(node)->color = RB_RED;
-        map_right_rotate(tree, rbnode_grand_parent(node));
-      }
-    }
-    else 
-    {
-      uncle = rbnode_left_uncle(node);
-      if (uncle != 0 && rbnode_is_red(uncle)) 
-      {
-        node->parent->color = RB_BLACK;
-        rbnode_grand_parent(node)->color = RB_RED;
-        uncle->color = RB_BLACK;
-        node = rbnode_grand_parent(node);
-      }
-      else 
-      {
-        if (rbnode_is_left_child(node)) 
-        {
-          node = node->parent;
-          map_right_rotate(tree, node);
-        }
-        node->parent->color = RB_BLACK;
-        rbnode_grand_parent(node)->color = RB_RED;
-        map_left_rotate(tree, rbnode_grand_parent(node));
-      }
-    }
-  }
-  tree->root->color = RB_BLACK;
-}
-
-map* map_alloc() 
-{
-  map* new_tree = (map*)malloc(sizeof(map));
-  memset(new_tree, 0, sizeof(map));
-  return new_tree;
-}
-
-void map_free(map* tree) 
-{
-  rbnode_destroy_with_children(tree->root);
-  free(tree);
-}
-
-void map_insert(map* tree, const char* key, void* data, const int tag) 
-{
-  rbnode* node = rbnode_create(key, data, tag);
-  rbnode* iterator;
-  int     comparison;
-  int     fail = 0;
-
-  if (tree->root == 0) 
-  {
-    tree_set_root(tree, node);
-    tree->size = 0;
-  }
-  else 
-  {
-    iterator = tree->root;
-    while (iterator != 0) 
-    {
-      comparison = strcmp(key, iterator->data.key);
-
-      /* key already exists */
-      if (comparison == 0) 
-      {
-        fail = 1;
-        iterator = 0;
-      }
-      /* new key < iterator's key */
-      else if (comparison < 0) 
-      {
-        /* left of iterator is free */
-        if (iterator->left != 0) 
-        {
-          iterator = iterator->left;
-        } 
-        /* left of iterator is occupied */
-        else 
-        {
-          rbnode_set_left_child(iterator, node);
-          iterator = 0;
-        }
-      }
-      /* new key > iterator's key */
-      else 
-      {
-        /* right of iterator is free */
-        if (iterator->right != 0) 
-        {
-          iterator = iterator->right;
-        }
-        /* right of iterator is occupied */
-        else 
-        {
-          rbnode_set_right_child(iterator, node);
-          iterator = 0;
-        }
-      }
-    }
-  }
-
-  /* tree requires rebalancing */
-  if (!fail) 
-  {
-    tree->size++;
-    map_insert_balance(tree, node);
-  }
-}
-
-generic* map_search(map* tree, const char* key)
-{
-  int comparison;
-
-  rbnode* iterator = tree->root;
-  while (iterator != 0) 
-  {
-    comparison = strcmp(key, iterator->data.key);
-    /* found */
-    if (comparison == 0) 
-    {
-      return &iterator->data.value;
-    }
-    /* key < iterator's key */
-    else if (comparison < 0) 
-    {
-      iterator = iterator->left;
-    }
-    /* key > iterator's key */
-    else 
-    {
-      iterator = iterator->right;
-    }
-  }
-  return 0;
-}
+#include "map.h"
+#include "hash.h"
+#include "rbtree.h"
+#include <string.h> /* strcmp */
+#include <stddef.h> /* offsetof */
+#include <stdlib.h> /* qsort */
+
+/**
+ * number of nodes in a subtree, 0 for null
+ */
+#define rbnode_count(n) ((n) ? (n)->count : 0)
+
+/**
+ * recounts nodes of a subtree from counts of its children
+ */
+#define rbnode_recount(n) ((n)->count = 1 + rbnode_count((n)->left) + rbnode_count((n)->right))
+
+/**
+ * keeps subtree node counts of maps with order statistics across rotations
+ */
+#define map_rbnode_update(t, n) do \
+{ \
+  if ((t)->order_statistics) rbnode_recount(n); \
+} while (0)
+
+RBTREE_DEFINE(map, map, rbnode, map_rbnode_update)
+
+/**
+ * size of a node holding a key of given length
+ */
+#define rbnode_size(length) (offsetof(rbnode, storage) + (length) + 1)
+
+/**
+ * node of a pooled map holding a key of given length is allocated from the pool
+ */
+#define rbnode_is_pooled(tree, length) ((tree)->nodes && (length) < MAP_POOL_KEY_CAPACITY)
+
+unsigned long long map_key_prefix(const char* key, int* length)
+{
+  unsigned long long prefix = 0;
+  int loop;
+
+  for (loop = 0; loop < 8 && key[loop]; loop++)
+  {
+    prefix |= (unsigned long long)(unsigned char)key[loop] << (56 - loop * 8);
+  }
+  *length = loop < 8 ? loop : loop + (int)strlen(key + 8);
+  return prefix;
+}
+
+/**
+ * compares a key with the key of a node. prefix and length are of the key.
+ * equal prefixes settle the comparison unless both keys are longer than the prefix.
+ */
+int map_compare(const char* key, const unsigned long long prefix, const int length, const rbnode* node);
+int map_compare(const char* key, const unsigned long long prefix, const int length, const rbnode* node)
+{
+  if (prefix != node->prefix) return prefix < node->prefix ? -1 : 1;
+  if (length < 8 || node->length < 8) return 0;
+  return strcmp(key + 8, node->storage + 8);
+}
+
+/**
+ * fills filter of a map with its keys, sized for at least given number of keys
+ */
+void map_filter_rebuild(map* tree, const int capacity, const int bits_per_key);
+void map_filter_rebuild(map* tree, const int capacity, const int bits_per_key)
+{
+  rbnode* node;
+
+  if (tree->filter) bloom_free(tree->filter);
+  tree->filter = bloom_alloc_with(tree->allocator_, capacity, bits_per_key);
+  for (node = map_first(tree); node; node = map_next(node))
+  {
+    bloom_add_hash(tree->filter, hash_bytes(node->storage, node->length, 0));
+  }
+}
+
+/**
+ * grows filter of a map, if any, once the map has outgrown it
+ */
+void map_filter_fit(map* tree);
+void map_filter_fit(map* tree)
+{
+  if (tree->filter && tree->size >= tree->filter->capacity) map_filter_rebuild(tree, tree->size * 2, tree->filter->bits_per_key);
+}
+
+/**
+ * adds a key of given length to filter of a map, if any
+ */
+void map_filter_add(map* tree, const char* key, const int length);
+void map_filter_add(map* tree, const char* key, const int length)
+{
+  if (!tree->filter) return;
+  map_filter_fit(tree);
+  bloom_add_hash(tree->filter, hash_bytes(key, length, 0));
+}
+
+/**
+ * create a new node from key-value pair 
+ * returns a red-black tree node with specified key-value pair
+ */ 
+rbnode* rbnode_create(map* tree, const char* key, void* pointer, const int tag);
+rbnode* rbnode_create(map* tree, const char* key, void* pointer, const int tag)
+{
+  rbnode* new_node;
+  int length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+
+  if (rbnode_is_pooled(tree, length)) 
+  {
+    new_node = (rbnode*)pool_get(tree->nodes);
+  }
+  else 
+  {
+    new_node = (rbnode*)allocator_allocate(tree->allocator_, rbnode_size(length));
+    if (tree->nodes) ++(tree->oversized);
+  }
+  memset(new_node, 0, offsetof(rbnode, storage));
+  memcpy(new_node->storage, key, length + 1);
+  new_node->length = length;
+  new_node->prefix = prefix;
+  new_node->data.key = new_node->storage;
+  new_node->data.value.pointer = pointer;
+  new_node->data.value.tag = tag,
+  new_node->color = RB_RED;
+  new_node->count = 1;
+  map_filter_add(tree, key, length);
+  return new_node;
+}
+
+/** 
+ * deletes a node.
+ */ 
+void rbnode_destroy(map* tree, rbnode* node);
+void rbnode_destroy(map* tree, rbnode* node)
+{
+  if (rbnode_is_pooled(tree, node->length)) 
+  {
+    pool_put(tree->nodes, node);
+  }
+  else 
+  {
+    allocator_release(tree->allocator_, node);
+    if (tree->nodes) --(tree->oversized);
+  }
+}
+
+/**
+ * deletes a node with its children.
+ */
+void rbnode_destroy_with_children(map* tree, rbnode* node);
+void rbnode_destroy_with_children(map* tree, rbnode* node)
+{
+  if (node->right) rbnode_destroy_with_children(tree, node->right);
+  if (node->left) rbnode_destroy_with_children(tree, node->left);
+  rbnode_destroy(tree, node);
+}
+
+map* map_alloc() 
+{
+  return map_alloc_with(0);
+}
+
+map* map_alloc_with(const allocator* allocator_) 
+{
+  map* new_tree;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_tree = (map*)allocator_allocate(allocator_, sizeof(map));
+  memset(new_tree, 0, sizeof(map));
+  new_tree->allocator_ = allocator_;
+  return new_tree;
+}
+
+map* map_alloc_pooled(const allocator* allocator_) 
+{
+  map* new_tree = map_alloc_with(allocator_);
+
+  new_tree->nodes = pool_alloc_with(new_tree->allocator_, rbnode_size(MAP_POOL_KEY_CAPACITY - 1), 256);
+  return new_tree;
+}
+
+void map_free(map* tree) 
+{
+  /* a pooled map without oversized nodes goes away with its pool */
+  if (tree->root && (!tree->nodes || tree->oversized)) rbnode_destroy_with_children(tree, tree->root);
+  if (tree->nodes) pool_free(tree->nodes);
+  if (tree->filter) bloom_free(tree->filter);
+  allocator_release(tree->allocator_, tree);
+}
+
+void map_attach_filter(map* tree, const int bits_per_key)
+{
+  map_filter_rebuild(tree, tree->size > 1024 ? tree->size * 2 : 1024, bits_per_key);
+}
+
+void map_detach_filter(map* tree)
+{
+  if (tree->filter) bloom_free(tree->filter);
+  tree->filter = 0;
+}
+
+generic* map_find_or_insert(map* tree, const char* key, void* data, const int tag, int* inserted) 
+{
+  int     length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+  rbnode* parent = 0;
+  rbnode* iterator = tree->root;
+  rbnode* node;
+  int     comparison = 0;
+
+  /* search first, a node is only created for a missing key */
+  while (iterator != 0) 
+  {
+    comparison = map_compare(key, prefix, length, iterator);
+
+    /* key already exists */
+    if (comparison == 0) 
+    {
+      if (inserted) *inserted = 0;
+      return &iterator->data.value;
+    }
+    parent = iterator;
+    iterator = comparison < 0 ? iterator->left : iterator->right;
+  }
+
+  node = rbnode_create(tree, key, data, tag);
+  if (parent == 0) tree_set_root(tree, node);
+  else if (comparison < 0) rbnode_set_left_child(parent, node);
+  else rbnode_set_right_child(parent, node);
+
+  /* tree requires rebalancing */
+  tree->size++;
+  if (tree->order_statistics) for (iterator = parent; iterator; iterator = iterator->parent) ++(iterator->count);
+  map_insert_balance(tree, node);
+  if (inserted) *inserted = 1;
+  return &node->data.value;
+}
+
+void map_insert(map* tree, const char* key, void* data, const int tag) 
+{
+  map_find_or_insert(tree, key, data, tag, 0);
+}
+
+int map_insert_or_assign(map* tree, const char* key, void* data, const int tag) 
+{
+  int inserted;
+  generic* value = map_find_or_insert(tree, key, data, tag, &inserted);
+
+  value->pointer = data;
+  value->tag = tag;
+  return inserted;
+}
+
+/**
+ * links nodes of a sorted array into a balanced subtree and returns its root.
+ * halves differ in size by at most one, so null children are found on two adjacent
+ * levels at most. nodes on the deepest level are coloured red and all others black,
+ * which gives every path the same number of black nodes.
+ */
+rbnode* map_link_sorted(rbnode** nodes, const int first, const int last, const int depth, const int deepest);
+rbnode* map_link_sorted(rbnode** nodes, const int first, const int last, const int depth, const int deepest)
+{
+  const int middle = first + (last - first) / 2;
+  rbnode* node;
+
+  if (first > last) return 0;
+  node = nodes[middle];
+  node->color = depth == deepest && depth > 0 ? RB_RED : RB_BLACK;
+  node->left = map_link_sorted(nodes, first, middle - 1, depth + 1, deepest);
+  node->right = map_link_sorted(nodes, middle + 1, last, depth + 1, deepest);
+  rbnode_recount(node);
+  if (node->left) node->left->parent = node;
+  if (node->right) node->right->parent = node;
+  return node;
+}
+
+/**
+ * replaces contents of a map with a balanced tree of nodes in key order
+ */
+void map_relink(map* tree, rbnode** nodes, const int count);
+void map_relink(map* tree, rbnode** nodes, const int count)
+{
+  int deepest = 0;
+
+  while ((2 << deepest) <= count) ++deepest;
+  tree->root = map_link_sorted(nodes, 0, count - 1, 0, deepest);
+  if (tree->root) tree->root->parent = 0;
+  tree->size = count;
+}
+
+/**
+ * orders pointers to pairs by key, then by position so earlier duplicates come first
+ */
+int map_compare_items(const void* a, const void* b);
+int map_compare_items(const void* a, const void* b)
+{
+  const meta* left = *(const meta* const*)a;
+  const meta* right = *(const meta* const*)b;
+  int comparison = strcmp(left->key, right->key);
+
+  if (comparison) return comparison;
+  return left < right ? -1 : left > right;
+}
+
+int map_build_from_sorted(map* tree, const meta* items, const int count)
+{
+  rbnode** nodes;
+  int loop;
+
+  if (tree->root) return 0;
+  for (loop = 1; loop < count; loop++)
+  {
+    if (strcmp(items[loop - 1].key, items[loop].key) >= 0) return 0;
+  }
+  if (count <= 0) return 1;
+  nodes = (rbnode**)allocator_allocate(tree->allocator_, count * sizeof(rbnode*));
+  for (loop = 0; loop < count; loop++)
+  {
+    nodes[loop] = rbnode_create(tree, items[loop].key, items[loop].value.pointer, items[loop].value.tag);
+  }
+  map_relink(tree, nodes, count);
+  /* keys were added to filter while size was still 0 */
+  map_filter_fit(tree);
+  allocator_release(tree->allocator_, nodes);
+  return 1;
+}
+
+void map_insert_batch(map* tree, const meta* items, const int count)
+{
+  const meta** sorted;
+  rbnode** nodes;
+  rbnode* existing;
+  int used = 0;
+  int loop;
+  int comparison;
+
+  if (count <= 0) return;
+  sorted = (const meta**)allocator_allocate(tree->allocator_, count * sizeof(meta*));
+  for (loop = 0; loop < count; loop++) sorted[loop] = &items[loop];
+  qsort(sorted, count, sizeof(meta*), map_compare_items);
+
+  /* a small batch goes into a large map one by one, still in key order */
+  if (count < tree->size / 16)
+  {
+    for (loop = 0; loop < count; loop++)
+    {
+      map_insert(tree, sorted[loop]->key, sorted[loop]->value.pointer, sorted[loop]->value.tag);
+    }
+    allocator_release(tree->allocator_, sorted);
+    return;
+  }
+
+  /* merge batch with nodes of map in key order, existing keys and later duplicates are skipped */
+  nodes = (rbnode**)allocator_allocate(tree->allocator_, (tree->size + count) * sizeof(rbnode*));
+  existing = map_first(tree);
+  for (loop = 0; loop < count; loop++)
+  {
+    if (loop > 0 && strcmp(sorted[loop - 1]->key, sorted[loop]->key) == 0) continue;
+    comparison = -1;
+    while (existing && (comparison = strcmp(existing->data.key, sorted[loop]->key)) < 0)
+    {
+      nodes[used++] = existing;
+      existing = map_next(existing);
+    }
+    if (existing && comparison == 0) continue;
+    nodes[used++] = rbnode_create(tree, sorted[loop]->key, sorted[loop]->value.pointer, sorted[loop]->value.tag);
+  }
+  for (; existing; existing = map_next(existing)) nodes[used++] = existing;
+  map_relink(tree, nodes, used);
+  /* new keys were added to filter while size stayed the same */
+  map_filter_fit(tree);
+  allocator_release(tree->allocator_, nodes);
+  allocator_release(tree->allocator_, sorted);
+}
+
+/**
+ * finds node of a key
+ * returns a null pointer if key is not found.
+ */
+rbnode* map_find(map* tree, const char* key);
+rbnode* map_find(map* tree, const char* key)
+{
+  int comparison;
+  int length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+  rbnode* iterator = tree->root;
+
+  if (tree->filter && !bloom_contains_hash(tree->filter, hash_bytes(key, length, 0))) return 0;
+  while (iterator != 0) 
+  {
+    comparison = map_compare(key, prefix, length, iterator);
+    /* found */
+    if (comparison == 0) 
+    {
+      return iterator;
+    }
+    /* key < iterator's key */
+    else if (comparison < 0) 
+    {
+      iterator = iterator->left;
+    }
+    /* key > iterator's key */
+    else 
+    {
+      iterator = iterator->right;
+    }
+  }
+  return 0;
+}
+
+/**
+ * first node of a subtree in key order
+ */
+rbnode* rbnode_minimum(rbnode* node);
+rbnode* rbnode_minimum(rbnode* node)
+{
+  while (node->left) node = node->left;
+  return node;
+}
+
+/**
+ * last node of a subtree in key order
+ */
+rbnode* rbnode_maximum(rbnode* node);
+rbnode* rbnode_maximum(rbnode* node)
+{
+  while (node->right) node = node->right;
+  return node;
+}
+
+generic* map_search(map* tree, const char* key)
+{
+  rbnode* node = map_find(tree, key);
+
+  return node ? &node->data.value : 0;
+}
+
+int map_remove(map* tree, const char* key)
+{
+  rbnode* node = map_find(tree, key);
+  rbnode* successor;
+  rbnode* child;
+  rbnode* parent;
+  int     color;
+
+  if (!node) return 0;
+  color = node->color;
+  if (tree->order_statistics) 
+  {
+    /* counts drop along the path from the node which is physically unlinked */
+    successor = node->left && node->right ? rbnode_minimum(node->right) : node;
+    for (parent = successor->parent; parent; parent = parent->parent) --(parent->count);
+  }
+  if (node->left == 0) 
+  {
+    child = node->right;
+    parent = node->parent;
+    map_transplant(tree, node, child);
+  }
+  else if (node->right == 0) 
+  {
+    child = node->left;
+    parent = node->parent;
+    map_transplant(tree, node, child);
+  }
+  else 
+  {
+    /* successor takes the place of the node, its own place is taken by its right child */
+    successor = rbnode_minimum(node->right);
+    color = successor->color;
+    child = successor->right;
+    if (successor->parent == node) 
+    {
+      parent = successor;
+    }
+    else 
+    {
+      parent = successor->parent;
+      map_transplant(tree, successor, child);
+      rbnode_set_right_child(successor, node->right);
+    }
+    map_transplant(tree, node, successor);
+    rbnode_set_left_child(successor, node->left);
+    successor->color = node->color;
+    successor->count = node->count;
+  }
+  if (color == RB_BLACK && tree->root) map_remove_balance(tree, child, parent);
+  rbnode_destroy(tree, node);
+  tree->size--;
+  return 1;
+}
+
+rbnode* map_first(map* tree)
+{
+  return tree->root ? rbnode_minimum(tree->root) : 0;
+}
+
+rbnode* map_last(map* tree)
+{
+  return tree->root ? rbnode_maximum(tree->root) : 0;
+}
+
+rbnode* map_next(rbnode* node)
+{
+  if (node->right) return rbnode_minimum(node->right);
+  while (rbnode_is_right_child(node)) node = node->parent;
+  return node->parent;
+}
+
+rbnode* map_prev(rbnode* node)
+{
+  if (node->left) return rbnode_maximum(node->left);
+  while (rbnode_is_left_child(node)) node = node->parent;
+  return node->parent;
+}
+
+rbnode* map_lower_bound(map* tree, const char* key)
+{
+  int length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+  rbnode* iterator = tree->root;
+  rbnode* bound = 0;
+
+  while (iterator != 0) 
+  {
+    if (map_compare(key, prefix, length, iterator) <= 0) 
+    {
+      bound = iterator;
+      iterator = iterator->left;
+    }
+    else 
+    {
+      iterator = iterator->right;
+    }
+  }
+  return bound;
+}
+
+rbnode* map_upper_bound(map* tree, const char* key)
+{
+  int length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+  rbnode* iterator = tree->root;
+  rbnode* bound = 0;
+
+  while (iterator != 0) 
+  {
+    if (map_compare(key, prefix, length, iterator) < 0) 
+    {
+      bound = iterator;
+      iterator = iterator->left;
+    }
+    else 
+    {
+      iterator = iterator->right;
+    }
+  }
+  return bound;
+}
+
+rbnode* map_prefix_first(map* tree, const char* prefix)
+{
+  rbnode* node = map_lower_bound(tree, prefix);
+
+  if (node && strncmp(node->data.key, prefix, strlen(prefix)) == 0) return node;
+  return 0;
+}
+
+rbnode* map_prefix_next(rbnode* node, const char* prefix)
+{
+  node = map_next(node);
+  if (node && strncmp(node->data.key, prefix, strlen(prefix)) == 0) return node;
+  return 0;
+}
+
+/**
+ * counts nodes of a subtree, setting counts of all nodes in it
+ */
+int rbnode_count_all(rbnode* node);
+int rbnode_count_all(rbnode* node)
+{
+  if (!node) return 0;
+  node->count = 1 + rbnode_count_all(node->left) + rbnode_count_all(node->right);
+  return node->count;
+}
+
+void map_enable_order_statistics(map* tree)
+{
+  if (tree->order_statistics) return;
+  rbnode_count_all(tree->root);
+  tree->order_statistics = 1;
+}
+
+rbnode* map_select(map* tree, const int k)
+{
+  rbnode* iterator = tree->root;
+  int index = k;
+
+  map_enable_order_statistics(tree);
+  if (k < 0 || k >= tree->size) return 0;
+  while (iterator) 
+  {
+    if (index < rbnode_count(iterator->left)) 
+    {
+      iterator = iterator->left;
+    }
+    else if (index == rbnode_count(iterator->left)) 
+    {
+      return iterator;
+    }
+    else 
+    {
+      index -= rbnode_count(iterator->left) + 1;
+      iterator = iterator->right;
+    }
+  }
+  return 0;
+}
+
+int map_rank(map* tree, const char* key)
+{
+  int length;
+  unsigned long long prefix = map_key_prefix(key, &length);
+  rbnode* iterator = tree->root;
+  int rank = 0;
+  int comparison;
+
+  map_enable_order_statistics(tree);
+  while (iterator) 
+  {
+    comparison = map_compare(key, prefix, length, iterator);
+    if (comparison <= 0) 
+    {
+      if (comparison == 0) return rank + rbnode_count(iterator->left);
+      iterator = iterator->left;
+    }
+    else 
+    {
+      rank += rbnode_count(iterator->left) + 1;
+      iterator = iterator->right;
+    }
+  }
+  return rank;
+}
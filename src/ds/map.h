@@ -1,100 +1,264 @@
-/*
-
-  The MIT License (MIT)
-
-  Copyright (c) 2015 VISUEM LTD
-
-  Permission is hereby granted, free of charge, to any person obtaining a copy
-  of this software and associated documentation files (the "Software"), to deal
-  in the Software without restriction, including without limitation the rights
-  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-  copies of the Software, and to permit persons to whom the Software is
-  furnished to do so, subject to the following conditions:
-
-  The above copyright notice and this permission notice shall be included in all
-  copies or substantial portions of the Software.
-
-  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-  SOFTWARE.
-
-*/
-
-/*
-*  author:    noyan gunday
-*  date:      dec 25th, 2006
-*  abstract:  red-black tree based type independent map
-*/
-
-#ifndef __VISUEM_MAP_H__
-#define __VISUEM_MAP_H__
-
-#include "generic.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-  /** 
-   * /brief key-value pair.
-   */
-  typedef struct 
-  {
-    char*                 key;
-    generic               value;
-  } meta;
-
-  /** 
-   * /brief red-black tree node.
-   */
-  typedef struct rbnode_ 
-  {
-    int                   color;
-    meta                  data;
-    struct rbnode_ *      left;
-    struct rbnode_ *      right;
-    struct rbnode_ *      parent;
-  } rbnode;
-
-  /** 
-   * /brief red-black tree based map
-   */
-  typedef struct 
-  {
-    rbnode*               root;
-    int                   size;
-  } map;
-
-  /** 
-   * /brief allocates a map
-   */
-  extern map* map_alloc();
-
-  /** 
-   * /bries deletes a map
-   * not responsible for deallocation of data within nodes
-   */    
-  extern void map_free(map* tree);
-
-  /** 
-   * /brief insert a node into map.
-   */
-  extern void map_insert(map* tree, const char* key, void* data, const int tag);
-
-  /** 
-   * /brief searches a map with a specific key 
-   *
-   * /return a void pointer to element related with given key.
-   *         a null pointer if key is not found.
-   */
-  extern generic* map_search(map* tree, const char* key);
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      dec 25th, 2006
+*  abstract:  red-black tree based type independent map
+*/
+
+#ifndef __VISUEM_MAP_H__
+#define __VISUEM_MAP_H__
+
+#include "generic.h"
+#include "allocator.h"
+#include "pool.h"
+#include "bloom.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief key-value pair.
+   */
+  typedef struct 
+  {
+    char*                 key;
+    generic               value;
+  } meta;
+
+  /** 
+   * /brief red-black tree node.
+   * key is stored inline at the end of the node, so a node is a single allocation of
+   * variable size. prefix holds first 8 bytes of the key in big-endian order, so 
+   * comparing prefixes as integers gives the same order as strcmp.
+   */
+  typedef struct rbnode_ 
+  {
+    int                   color;
+    int                   length;       /* length of key */
+    int                   count;        /* number of nodes in subtree, kept if map has order statistics */
+    unsigned long long    prefix;       /* first 8 bytes of key, zero padded */
+    struct rbnode_ *      left;
+    struct rbnode_ *      right;
+    struct rbnode_ *      parent;
+    meta                  data;         /* data.key points to storage */
+    char                  storage[1];   /* key, extends beyond the end of the structure */
+  } rbnode;
+
+  /**
+   * /brief key capacity of nodes of pooled maps. longer keys get a node of their own.
+   */
+#define MAP_POOL_KEY_CAPACITY 32
+
+  /** 
+   * /brief red-black tree based map
+   */
+  typedef struct 
+  {
+    rbnode*               root;
+    int                   size;
+    const allocator*      allocator_;
+    pool*                 nodes;        /* node pool of map, null if nodes are allocated individually */
+    int                   oversized;    /* number of nodes of a pooled map which didn't fit into pool */
+    bloom*                filter;       /* filter of keys consulted before searches, null if none */
+    int                   order_statistics; /* subtree node counts are maintained */
+  } map;
+
+  /** 
+   * /brief allocates a map
+   */
+  extern map* map_alloc();
+
+  /** 
+   * /brief allocates a map which gets its memory from a given allocator
+   */
+  extern map* map_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief allocates a map which takes its nodes from a pool
+   * pool slabs come from given allocator. nodes are released together with the pool 
+   * when map is freed, nodes of keys longer than MAP_POOL_KEY_CAPACITY are released 
+   * individually.
+   */
+  extern map* map_alloc_pooled(const allocator* allocator_);
+
+  /** 
+   * /bries deletes a map
+   * not responsible for deallocation of data within nodes
+   */    
+  extern void map_free(map* tree);
+
+  /** 
+   * /brief attaches a bloom filter to map, so searches for missing keys mostly end
+   * before walking the tree. filter is kept up to date by inserts and rebuilt larger
+   * when map outgrows it. removed keys stay in filter until next rebuild, which only 
+   * costs an occasional full search.
+   */
+  extern void map_attach_filter(map* tree, const int bits_per_key);
+
+  /** 
+   * /brief removes bloom filter of map, if any
+   */
+  extern void map_detach_filter(map* tree);
+
+  /** 
+   * /brief insert a node into map. nothing is changed if key already exists.
+   */
+  extern void map_insert(map* tree, const char* key, void* data, const int tag);
+
+  /** 
+   * /brief searches map for a key, inserting it with given value if it is missing.
+   * a node is only allocated when key is inserted. inserted, if not null, is set to 1
+   * if key is inserted and 0 if it already existed.
+   *
+   * /return pointer to value of key, existing or new.
+   */
+  extern generic* map_find_or_insert(map* tree, const char* key, void* data, const int tag, int* inserted);
+
+  /** 
+   * /brief inserts a key with given value, or assigns value to key if it exists.
+   * not responsible for deallocation of data replaced.
+   * /return 1 if key is inserted, 0 if it is assigned.
+   */
+  extern int map_insert_or_assign(map* tree, const char* key, void* data, const int tag);
+
+  /** 
+   * /brief builds an empty map from pairs sorted by key in linear time
+   * keys must be strictly ascending in strcmp order, keys are copied.
+   * /return 1 on success, 0 if map isn't empty or keys aren't strictly ascending, 
+   *         in which case map is left untouched.
+   */
+  extern int map_build_from_sorted(map* tree, const meta* items, const int count);
+
+  /** 
+   * /brief inserts pairs in any order into map.
+   * batch is sorted and merged with existing nodes into a rebuilt balanced tree. as
+   * with map_insert, keys which already exist are left alone, of duplicates within 
+   * the batch the first one is inserted. nodes are relinked but never moved, so 
+   * pointers to values already in map stay valid.
+   */
+  extern void map_insert_batch(map* tree, const meta* items, const int count);
+
+  /** 
+   * /brief searches a map with a specific key 
+   *
+   * /return a void pointer to element related with given key.
+   *         a null pointer if key is not found.
+   */
+  extern generic* map_search(map* tree, const char* key);
+
+  /** 
+   * /brief removes a key from map
+   * not responsible for deallocation of data within node
+   * /return 1 if key is removed, 0 if it is not found.
+   */
+  extern int map_remove(map* tree, const char* key);
+
+  /** 
+   * /brief node with the smallest key
+   * /return a null pointer if map is empty.
+   */
+  extern rbnode* map_first(map* tree);
+
+  /** 
+   * /brief node with the largest key
+   * /return a null pointer if map is empty.
+   */
+  extern rbnode* map_last(map* tree);
+
+  /** 
+   * /brief node which comes after a given node in key order
+   * walks parent links, so iterating a whole map needs no extra memory.
+   * /return a null pointer if node is the last one.
+   */
+  extern rbnode* map_next(rbnode* node);
+
+  /** 
+   * /brief node which comes before a given node in key order
+   * /return a null pointer if node is the first one.
+   */
+  extern rbnode* map_prev(rbnode* node);
+
+  /** 
+   * /brief first node whose key is not less than a given key
+   * /return a null pointer if there is no such node.
+   */
+  extern rbnode* map_lower_bound(map* tree, const char* key);
+
+  /** 
+   * /brief first node whose key is greater than a given key
+   * /return a null pointer if there is no such node.
+   */
+  extern rbnode* map_upper_bound(map* tree, const char* key);
+
+  /** 
+   * /brief first node whose key starts with a given prefix
+   * /return a null pointer if there is no such node.
+   */
+  extern rbnode* map_prefix_first(map* tree, const char* prefix);
+
+  /** 
+   * /brief node after a given one if its key starts with a given prefix. eg.
+   *
+   *   for (node = map_prefix_first(tree, "textures/"); node; node = map_prefix_next(node, "textures/"))
+   *
+   * /return a null pointer if next key doesn't start with prefix.
+   */
+  extern rbnode* map_prefix_next(rbnode* node, const char* prefix);
+
+  /** 
+   * /brief makes map maintain number of nodes of every subtree from now on, which 
+   * map_select and map_rank need. costs a pass over nodes of map once and a walk up
+   * the tree on every insertion and removal.
+   */
+  extern void map_enable_order_statistics(map* tree);
+
+  /** 
+   * /brief node with k-th smallest key, counting from 0
+   * enables order statistics of map if they aren't already.
+   * /return a null pointer if k is out of range.
+   */
+  extern rbnode* map_select(map* tree, const int k);
+
+  /** 
+   * /brief number of keys less than a given key, which need not be in map
+   * enables order statistics of map if they aren't already.
+   */
+  extern int map_rank(map* tree, const char* key);
+
+  /** 
+   * /brief packs first 8 bytes of a key into an integer in big-endian order, as stored 
+   * in prefix of a node, and measures length of the key.
+   */
+  extern unsigned long long map_key_prefix(const char* key, int* length);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "pool.h"
+#include <memory.h> /* memset */
+
+/**
+ * alignment of pool elements
+ */
+#define POOL_ALIGNMENT  (sizeof(void*) > sizeof(double) ? sizeof(void*) : sizeof(double))
+
+/**
+ * size of slab header, rounded up to element alignment
+ */
+#define POOL_SLAB_HEADER  ((sizeof(pool_slab) + POOL_ALIGNMENT - 1) / POOL_ALIGNMENT * POOL_ALIGNMENT)
+
+/**
+ * allocator interface of a pool
+ */
+void* pool_view_allocate(void* context, const size_t size);
+void* pool_view_allocate(void* context, const size_t size)
+{
+  pool* pool_ = (pool*)context;
+
+  if (size > pool_->element_size) return 0;
+  return pool_get(pool_);
+}
+
+void* pool_view_reallocate(void* context, void* pointer, const size_t size);
+void* pool_view_reallocate(void* context, void* pointer, const size_t size)
+{
+  pool* pool_ = (pool*)context;
+
+  if (size > pool_->element_size) return 0;
+  return pointer ? pointer : pool_get(pool_);
+}
+
+void pool_view_release(void* context, void* pointer);
+void pool_view_release(void* context, void* pointer)
+{
+  if (pointer) pool_put((pool*)context, pointer);
+}
+
+pool* pool_alloc(const size_t element_size, const int elements_per_slab)
+{
+  return pool_alloc_with(0, element_size, elements_per_slab);
+}
+
+pool* pool_alloc_with(const allocator* allocator_, const size_t element_size, const int elements_per_slab)
+{
+  pool* new_pool;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_pool = (pool*)allocator_allocate(allocator_, sizeof(pool));
+  memset(new_pool, 0, sizeof(pool));
+  new_pool->element_size = element_size < sizeof(void*) ? sizeof(void*) : element_size;
+  new_pool->element_size = (new_pool->element_size + POOL_ALIGNMENT - 1) / POOL_ALIGNMENT * POOL_ALIGNMENT;
+  new_pool->elements_per_slab = elements_per_slab > 0 ? elements_per_slab : 256;
+  new_pool->allocator_ = allocator_;
+  new_pool->view.allocate = pool_view_allocate;
+  new_pool->view.reallocate = pool_view_reallocate;
+  new_pool->view.release = pool_view_release;
+  new_pool->view.context = new_pool;
+  return new_pool;
+}
+
+void pool_free(pool* pool_)
+{
+  pool_slab* slab = pool_->slabs;
+  pool_slab* next;
+
+  while (slab)
+  {
+    next = slab->next;
+    allocator_release(pool_->allocator_, slab);
+    slab = next;
+  }
+  allocator_release(pool_->allocator_, pool_);
+}
+
+void* pool_get(pool* pool_)
+{
+  void* element;
+  pool_slab* slab;
+
+  if (pool_->free_list)
+  {
+    element = pool_->free_list;
+    pool_->free_list = *(void**)element;
+    return element;
+  }
+  if (pool_->cursor == pool_->end)
+  {
+    slab = (pool_slab*)allocator_allocate(pool_->allocator_, POOL_SLAB_HEADER + pool_->element_size * pool_->elements_per_slab);
+    slab->next = pool_->slabs;
+    pool_->slabs = slab;
+    pool_->cursor = (char*)slab + POOL_SLAB_HEADER;
+    pool_->end = pool_->cursor + pool_->element_size * pool_->elements_per_slab;
+  }
+  element = pool_->cursor;
+  pool_->cursor += pool_->element_size;
+  return element;
+}
+
+void pool_put(pool* pool_, void* element)
+{
+  *(void**)element = pool_->free_list;
+  pool_->free_list = element;
+}
+
+const allocator* pool_allocator(pool* pool_)
+{
+  return &pool_->view;
+}
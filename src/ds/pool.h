@@ -0,0 +1,106 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  fixed size element pool
+*/
+
+#ifndef __VISUEM_POOL_H__
+#define __VISUEM_POOL_H__
+
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief a slab of pool elements. elements follow the header.
+   */
+  typedef struct pool_slab_
+  {
+    struct pool_slab_*    next;
+  } pool_slab;
+
+  /** 
+   * /brief fixed size element pool
+   * elements are carved out of slabs of elements_per_slab elements. released elements go 
+   * into a free list and are reused before the slabs are touched again. all elements of 
+   * a pool are released at once when the pool is freed.
+   */
+  typedef struct 
+  {
+    void*                 free_list;          /* released elements */
+    pool_slab*            slabs;              /* allocated slabs, newest first */
+    char*                 cursor;             /* next unused element in newest slab */
+    char*                 end;                /* end of newest slab */
+    size_t                element_size;       /* size of a single element */
+    int                   elements_per_slab;  /* number of elements in a slab */
+    const allocator*      allocator_;         /* allocator of pool and its slabs */
+    allocator             view;               /* allocator interface of pool. see pool_allocator */
+  } pool;
+
+  /** 
+   * /brief allocates a pool of elements of given size
+   */
+  extern pool* pool_alloc(const size_t element_size, const int elements_per_slab);
+
+  /** 
+   * /brief allocates a pool of elements of given size which gets its slabs from a given allocator
+   */
+  extern pool* pool_alloc_with(const allocator* allocator_, const size_t element_size, const int elements_per_slab);
+
+  /** 
+   * /brief deletes a pool and releases all of its elements at once
+   */
+  extern void pool_free(pool* pool_);
+
+  /** 
+   * /brief takes an element from the pool
+   */
+  extern void* pool_get(pool* pool_);
+
+  /** 
+   * /brief puts an element back to the pool
+   */
+  extern void pool_put(pool* pool_, void* element);
+
+  /** 
+   * /brief returns an allocator interface for the pool.
+   * it serves requests up to element size of the pool and fails on anything larger. 
+   * eg. tree_alloc_with(pool_allocator(nodes), ...) with a pool of sizeof(tree_node)
+   * elements keeps a whole tree in the pool. such a tree can be dropped with a single 
+   * pool_free instead of tree_free.
+   */
+  extern const allocator* pool_allocator(pool* pool_);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,324 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  red-black tree machinery shared by tree based containers
+*/
+
+#ifndef __VISUEM_RBTREE_H__
+#define __VISUEM_RBTREE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief node colours
+   */
+#define RB_BLACK        0
+#define RB_RED          1
+
+  /*
+   * macros below work on any node type with color, left, right and parent fields and
+   * any tree type with a root field.
+   */
+
+  /** 
+   * /brief set the node's right child 
+   */
+#define rbnode_set_right_child(n, r) do \
+{ \
+  (n)->right = (r); \
+  if ((r) != 0) (r)->parent = (n); \
+} while (0)
+
+  /**
+   * /brief set the node's left child 
+   */
+#define rbnode_set_left_child(n, l) do \
+{ \
+  (n)->left = (l); \
+  if ((l) != 0) (l)->parent = (n); \
+} while (0)
+
+  /** 
+   * /brief set tree's root node 
+   */
+#define tree_set_root(t, n) do \
+{ \
+  t->root = (n); \
+  if ((n) != 0) { \
+  (n)->parent = 0; \
+  (n)->color = RB_BLACK; \
+  } \
+} while (0)
+
+  /** 
+   * /brief is node a left child of its parent 
+   */
+#define rbnode_is_left_child(n) ((n)->parent != 0 && (n)->parent->left == (n))
+
+  /** 
+   * /brief is node a right child of its parent 
+   */
+#define rbnode_is_right_child(n) ((n)->parent != 0 && (n)->parent->right == (n))
+
+  /** 
+   * /brief is node a root node 
+   */
+#define rbnode_is_root(n) ((n)->parent == 0)
+
+  /** 
+   * /brief is node a leaf node 
+   */
+#define rbnode_is_leaf(n) ((n)->left == 0 && (n)->right == 0)
+
+  /** 
+   * /brief is node a red node 
+   */
+#define rbnode_is_red(n) ((n)->color == RB_RED)
+
+  /** 
+   * /brief is node a black node 
+   */
+#define rbnode_is_black(n) ((n)->color == RB_BLACK)
+
+  /**
+   * /brief is node black. null leaves count as black.
+   */
+#define rbnode_is_black_or_null(n) ((n) == 0 || (n)->color == RB_BLACK)
+
+  /** 
+   * /brief node's right uncle (if its parent is a right child) 
+   */
+#define rbnode_right_uncle(n) ((n)->parent->parent->right)
+
+  /** 
+   * /brief node's left uncle (if its parent is a left child) 
+   */
+#define rbnode_left_uncle(n) ((n)->parent->parent->left)
+
+  /** 
+   * /brief node's grand parent node 
+   */
+#define rbnode_grand_parent(n) ((n)->parent->parent)
+
+  /**
+   * /brief defines rotation and rebalancing functions of a red-black tree type.
+   *
+   * name##_left_rotate, name##_right_rotate, name##_transplant, name##_insert_balance
+   * and name##_remove_balance are defined for given tree and node types. update(t, n)
+   * is invoked on both nodes moved by a rotation, lower one first, so augmented trees 
+   * can recompute subtree data of a node from its children. pass rbtree_no_update for
+   * plain trees. eg.
+   *
+   *   RBTREE_DEFINE(map, map, rbnode, rbtree_no_update)
+   */
+#define RBTREE_DEFINE(name, tree_type, node_type, update) \
+  void name##_left_rotate(tree_type* tree, node_type* node); \
+  void name##_left_rotate(tree_type* tree, node_type* node) \
+  { \
+    node_type* r = node->right; \
+    \
+    rbnode_set_right_child(node, r->left); \
+    if (rbnode_is_root(node)) tree_set_root(tree, r); \
+    else if (rbnode_is_right_child(node)) rbnode_set_right_child(node->parent, r); \
+    else rbnode_set_left_child(node->parent, r); \
+    rbnode_set_left_child(r, node); \
+    update(tree, node); \
+    update(tree, r); \
+  } \
+  \
+  void name##_right_rotate(tree_type* tree, node_type* node); \
+  void name##_right_rotate(tree_type* tree, node_type* node) \
+  { \
+    node_type* l = node->left; \
+    \
+    rbnode_set_left_child(node, l->right); \
+    if (rbnode_is_root(node)) tree_set_root(tree, l); \
+    else if (rbnode_is_right_child(node)) rbnode_set_right_child(node->parent, l); \
+    else rbnode_set_left_child(node->parent, l); \
+    rbnode_set_right_child(l, node); \
+    update(tree, node); \
+    update(tree, l); \
+  } \
+  \
+  /* puts node v into the place of node u within the tree. children of v aren't touched. */ \
+  void name##_transplant(tree_type* tree, node_type* u, node_type* v); \
+  void name##_transplant(tree_type* tree, node_type* u, node_type* v) \
+  { \
+    if (rbnode_is_root(u)) tree->root = v; \
+    else if (rbnode_is_left_child(u)) u->parent->left = v; \
+    else u->parent->right = v; \
+    if (v) v->parent = u->parent; \
+  } \
+  \
+  /* balances tree after an insertion. */ \
+  void name##_insert_balance(tree_type* tree, node_type* node); \
+  void name##_insert_balance(tree_type* tree, node_type* node) \
+  { \
+    node_type* uncle; \
+    \
+    while (rbnode_is_root(node) == 0 && node->parent->color == RB_RED) \
+    { \
+      if (rbnode_is_left_child(node->parent)) \
+      { \
+        uncle = rbnode_right_uncle(node); \
+        if (uncle != 0 && rbnode_is_red(uncle)) \
+        { \
+          node->parent->color = RB_BLACK; \
+          rbnode_grand_parent(node)->color = RB_RED; \
+          uncle->color = RB_BLACK; \
+          node = rbnode_grand_parent(node); \
+        } \
+        else \
+        { \
+          if (rbnode_is_right_child(node)) \
+          { \
+            node = node->parent; \
+            name##_left_rotate(tree, node); \
+          } \
+          node->parent->color = RB_BLACK; \
+          rbnode_grand_parent(node)->color = RB_RED; \
+          name##_right_rotate(tree, rbnode_grand_parent(node)); \
+        } \
+      } \
+      else \
+      { \
+        uncle = rbnode_left_uncle(node); \
+        if (uncle != 0 && rbnode_is_red(uncle)) \
+        { \
+          node->parent->color = RB_BLACK; \
+          rbnode_grand_parent(node)->color = RB_RED; \
+          uncle->color = RB_BLACK; \
+          node = rbnode_grand_parent(node); \
+        } \
+        else \
+        { \
+          if (rbnode_is_left_child(node)) \
+          { \
+            node = node->parent; \
+            name##_right_rotate(tree, node); \
+          } \
+          node->parent->color = RB_BLACK; \
+          rbnode_grand_parent(node)->color = RB_RED; \
+          name##_left_rotate(tree, rbnode_grand_parent(node)); \
+        } \
+      } \
+    } \
+    tree->root->color = RB_BLACK; \
+  } \
+  \
+  /* balances tree after a removal. node is the one which took the place of the removed */ \
+  /* black node, possibly null, parent is its parent. */ \
+  void name##_remove_balance(tree_type* tree, node_type* node, node_type* parent); \
+  void name##_remove_balance(tree_type* tree, node_type* node, node_type* parent) \
+  { \
+    node_type* sibling; \
+    \
+    while (node != tree->root && rbnode_is_black_or_null(node)) \
+    { \
+      if (node == parent->left) \
+      { \
+        sibling = parent->right; \
+        if (rbnode_is_red(sibling)) \
+        { \
+          sibling->color = RB_BLACK; \
+          parent->color = RB_RED; \
+          name##_left_rotate(tree, parent); \
+          sibling = parent->right; \
+        } \
+        if (rbnode_is_black_or_null(sibling->left) && rbnode_is_black_or_null(sibling->right)) \
+        { \
+          sibling->color = RB_RED; \
+          node = parent; \
+          parent = node->parent; \
+        } \
+        else \
+        { \
+          if (rbnode_is_black_or_null(sibling->right)) \
+          { \
+            sibling->left->color = RB_BLACK; \
+            sibling->color = RB_RED; \
+            name##_right_rotate(tree, sibling); \
+            sibling = parent->right; \
+          } \
+          sibling->color = parent->color; \
+          parent->color = RB_BLACK; \
+          sibling->right->color = RB_BLACK; \
+          name##_left_rotate(tree, parent); \
+          node = tree->root; \
+        } \
+      } \
+      else \
+      { \
+        sibling = parent->left; \
+        if (rbnode_is_red(sibling)) \
+        { \
+          sibling->color = RB_BLACK; \
+          parent->color = RB_RED; \
+          name##_right_rotate(tree, parent); \
+          sibling = parent->left; \
+        } \
+        if (rbnode_is_black_or_null(sibling->left) && rbnode_is_black_or_null(sibling->right)) \
+        { \
+          sibling->color = RB_RED; \
+          node = parent; \
+          parent = node->parent; \
+        } \
+        else \
+        { \
+          if (rbnode_is_black_or_null(sibling->left)) \
+          { \
+            sibling->right->color = RB_BLACK; \
+            sibling->color = RB_RED; \
+            name##_left_rotate(tree, sibling); \
+            sibling = parent->left; \
+          } \
+          sibling->color = parent->color; \
+          parent->color = RB_BLACK; \
+          sibling->left->color = RB_BLACK; \
+          name##_right_rotate(tree, parent); \
+          node = tree->root; \
+        } \
+      } \
+    } \
+    if (node) node->color = RB_BLACK; \
+  }
+
+  /**
+   * /brief update argument of RBTREE_DEFINE for trees without augmented data
+   */
+#define rbtree_no_update(t, n) ((void)(t), (void)(n))
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -1,95 +1,231 @@
-#include "tree.h"
-#include <stdlib.h> /* malloc */
-#include <memory.h> /* memset */
-
-tree_node* tree_alloc(void* data, const int tag)
-{
-  tree_node* new_node;
-
-  new_node = (tree_node*)malloc(sizeof(tree_node));
-  memset(new_node, 0, sizeof(tree_node));
-  new_node->data.pointer = data;
-  new_node->data.tag = tag;
-
-  return new_node;
-}
-
-void tree_free(tree_node* node)
-{
-  tree_node* iterator = node->first_child;
-
-  while (iterator) 
-  {
-    tree_free(iterator);
-    iterator = iterator->next_sibling;
-  }
-  free(node);
-}
-
-void tree_insert(tree_node* location, tree_node* node, const tree_insertion method)
-{
-  if (!location || !node) return;
-  switch (method) 
-  {
-  case insert_before:
-    node->next_sibling = location;
-    node->prev_sibling = location->prev_sibling;
-    node->parent = location->parent;
-    if (location->prev_sibling) location->prev_sibling->next_sibling = node;
-    else if (node->parent) node->parent->first_child = node;
-    location->prev_sibling = node;
-    break;
-  case insert_after:
-    node->next_sibling = location->next_sibling;
-    node->prev_sibling = location;
-    node->parent = location->parent;
-    if (location->next_sibling) location->next_sibling->prev_sibling = node;
-    else if (node->parent) node->parent->last_child = node;
-    location->next_sibling = node;
-    break;
-  case insert_as_first_child:
-    if (location->first_child) location->first_child->prev_sibling = node;
-    node->next_sibling = location->first_child;
-    node->prev_sibling = 0;
-    node->parent = location;
-    location->first_child = node;
-    if (!location->last_child && !node->next_sibling) location->last_child = node; 
-    break;
-  case insert_as_last_child:
-    if (location->last_child) location->last_child->next_sibling = node;
-    node->next_sibling = 0;
-    node->prev_sibling = location->last_child;
-    node->parent = location;
-    location->last_child = node;
-    if (!location->first_child && !node->prev_sibling) location->first_child = node; 
-    break;
-  }
-}
-
-tree_node* tree_insert_data(tree_node* location, void* data, const int tag, const tree_insertion method)
-{
-  tree_node* new_node;
-
-  if (!location) return 0;
-  new_node = (tree_node*)malloc(sizeof(tree_node));
-  new_node->first_child = 0;
-  new_node->last_child = 0;
-  new_node->data.pointer = data;
-  new_node->data.tag = tag;
-  tree_insert(location, new_node, method);
-
-  return new_node;
-}
-
-void tree_remove(tree_node* node) 
-{
-  if (node->next_sibling) node->next_sibling->prev_sibling = node->prev_sibling;
-  if (node->prev_sibling) node->prev_sibling->next_sibling = node->next_sibling;
-  if (node->parent) 
-  {
-    if (node->parent->first_child == node) node->parent->first_child = node->next_sibling;
-    if (node->parent->last_child == node) node->parent->last_child = node->prev_sibling;
-    if (node->parent->first_child && !node->parent->last_child) node->parent->last_child = node->parent->first_child;
-    if (!node->parent->first_child && node->parent->last_child) node->parent->first_child = node->parent->last_child;
-  }
-}
+#include "tree.h"
+#include <stdlib.h> /* malloc */
+#include <memory.h> /* memset */
+#include <stdatomic.h>
+
+/**
+ * process wide count of structural edits
+ */
+atomic_uint tree_structure_epoch;
+
+tree_node* tree_alloc(void* data, const int tag)
+{
+  return tree_alloc_with(0, data, tag);
+}
+
+tree_node* tree_alloc_with(const allocator* allocator_, void* data, const int tag)
+{
+  tree_node* new_node;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_node = (tree_node*)allocator_allocate(allocator_, sizeof(tree_node));
+  memset(new_node, 0, sizeof(tree_node));
+  new_node->data.pointer = data;
+  new_node->data.tag = tag;
+  new_node->allocator_ = allocator_;
+
+  return new_node;
+}
+
+/**
+ * records a structural edit below a parent, which may be a null pointer
+ */
+void tree_touch(tree_node* parent);
+void tree_touch(tree_node* parent)
+{
+  if (parent) ++(parent->version);
+  atomic_fetch_add_explicit(&tree_structure_epoch, 1, memory_order_relaxed);
+}
+
+unsigned int tree_epoch()
+{
+  return atomic_load_explicit(&tree_structure_epoch, memory_order_relaxed);
+}
+
+/**
+ * first node a given number of levels below node, in left to right order.
+ * returns a null pointer if subtree of node isn't that deep.
+ */
+tree_node* tree_level_first(tree_node* node, const int levels);
+tree_node* tree_level_first(tree_node* node, const int levels)
+{
+  const tree_node* top = node;
+  int depth = 0;
+
+  for (;;)
+  {
+    if (depth == levels) return node;
+    if (node->first_child) 
+    {
+      node = node->first_child;
+      ++depth;
+      continue;
+    }
+    while (node != top && !node->next_sibling) 
+    {
+      node = node->parent;
+      --depth;
+    }
+    if (node == top) return 0;
+    node = node->next_sibling;
+  }
+}
+
+tree_node* tree_pre_order_next(const tree_node* root, tree_node* node)
+{
+  if (node->first_child) return node->first_child;
+  while (node != root) 
+  {
+    if (node->next_sibling) return node->next_sibling;
+    node = node->parent;
+  }
+  return 0;
+}
+
+tree_node* tree_post_order_first(tree_node* root)
+{
+  while (root->first_child) root = root->first_child;
+  return root;
+}
+
+tree_node* tree_post_order_next(const tree_node* root, tree_node* node)
+{
+  if (node == root) return 0;
+  if (node->next_sibling) return tree_post_order_first(node->next_sibling);
+  return node->parent;
+}
+
+tree_node* tree_breadth_first_next(const tree_node* root, tree_node* node, int* depth)
+{
+  tree_node* sibling;
+  tree_node* found;
+  int levels = 0;
+
+  /* rest of the level, right of node */
+  while (node != root) 
+  {
+    for (sibling = node->next_sibling; sibling; sibling = sibling->next_sibling) 
+    {
+      if ((found = tree_level_first(sibling, levels)) != 0) return found;
+    }
+    node = node->parent;
+    ++levels;
+  }
+  /* start of the next level */
+  found = tree_level_first(node, *depth + 1);
+  if (found) ++(*depth);
+  return found;
+}
+
+int tree_visit(tree_node* root, const tree_traversal order, tree_visitor visitor, void* context)
+{
+  tree_node* node;
+  tree_node* next;
+  int depth = 0;
+  int result;
+
+  switch (order) 
+  {
+  case tree_pre_order:
+    for (node = root; node; node = tree_pre_order_next(root, node)) 
+    {
+      if ((result = visitor(context, node)) != 0) return result;
+    }
+    break;
+  case tree_post_order:
+    /* next is taken before visiting, so visitor may release node */
+    for (node = tree_post_order_first(root); node; node = next) 
+    {
+      next = tree_post_order_next(root, node);
+      if ((result = visitor(context, node)) != 0) return result;
+    }
+    break;
+  case tree_breadth_first:
+    for (node = root; node; node = tree_breadth_first_next(root, node, &depth)) 
+    {
+      if ((result = visitor(context, node)) != 0) return result;
+    }
+    break;
+  }
+  return 0;
+}
+
+void tree_free(tree_node* node)
+{
+  tree_node* iterator = tree_post_order_first(node);
+  tree_node* next;
+
+  /* children go before their parent, and every node is left before it is released */
+  while (iterator) 
+  {
+    next = tree_post_order_next(node, iterator);
+    allocator_release(iterator->allocator_, iterator);
+    iterator = next;
+  }
+}
+
+void tree_insert(tree_node* location, tree_node* node, const tree_insertion method)
+{
+  if (!location || !node) return;
+  tree_touch(method == insert_before || method == insert_after ? location->parent : location);
+  switch (method) 
+  {
+  case insert_before:
+    node->next_sibling = location;
+    node->prev_sibling = location->prev_sibling;
+    node->parent = location->parent;
+    if (location->prev_sibling) location->prev_sibling->next_sibling = node;
+    else if (node->parent) node->parent->first_child = node;
+    location->prev_sibling = node;
+    break;
+  case insert_after:
+    node->next_sibling = location->next_sibling;
+    node->prev_sibling = location;
+    node->parent = location->parent;
+    if (location->next_sibling) location->next_sibling->prev_sibling = node;
+    else if (node->parent) node->parent->last_child = node;
+    location->next_sibling = node;
+    break;
+  case insert_as_first_child:
+    if (location->first_child) location->first_child->prev_sibling = node;
+    node->next_sibling = location->first_child;
+    node->prev_sibling = 0;
+    node->parent = location;
+    location->first_child = node;
+    if (!location->last_child && !node->next_sibling) location->last_child = node; 
+    break;
+  case insert_as_last_child:
+    if (location->last_child) location->last_child->next_sibling = node;
+    node->next_sibling = 0;
+    node->prev_sibling = location->last_child;
+    node->parent = location;
+    location->last_child = node;
+    if (!location->first_child && !node->prev_sibling) location->first_child = node; 
+    break;
+  }
+}
+
+tree_node* tree_insert_data(tree_node* location, void* data, const int tag, const tree_insertion method)
+{
+  tree_node* new_node;
+
+  if (!location) return 0;
+  new_node = tree_alloc_with(location->allocator_, data, tag);
+  tree_insert(location, new_node, method);
+
+  return new_node;
+}
+
+void tree_remove(tree_node* node) 
+{
+  tree_touch(node->parent);
+  if (node->next_sibling) node->next_sibling->prev_sibling = node->prev_sibling;
+  if (node->prev_sibling) node->prev_sibling->next_sibling = node->next_sibling;
+  if (node->parent) 
+  {
+    if (node->parent->first_child == node) node->parent->first_child = node->next_sibling;
+    if (node->parent->last_child == node) node->parent->last_child = node->prev_sibling;
+    if (node->parent->first_child && !node->parent->last_child) node->parent->last_child = node->parent->first_child;
+    if (!node->parent->first_child && node->parent->last_child) node->parent->first_child = node->parent->last_child;
+  }
+}
@@ -1,96 +1,173 @@
-/*
-
-  The MIT License (MIT)
-
-  Copyright (c) 2015 VISUEM LTD
-
-  Permission is hereby granted, free of charge, to any person obtaining a copy
-  of this software and associated documentation files (the "Software"), to deal
-  in the Software without restriction, including without limitation the rights
-  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-  copies of the Software, and to permit persons to whom the Software is
-  furnished to do so, subject to the following conditions:
-
-  The above copyright notice and this permission notice shall be included in all
-  copies or substantial portions of the Software.
-
-  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-  SOFTWARE.
-
-*/
-
-/*
-*  author:    noyan gunday
-*  date:      dec 24th, 2006
-*  abstract:  type independent tree
-*/
-
-#ifndef __VISUEM_TREE_H__
-#define __VISUEM_TREE_H__
-
-#include "generic.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-  /**
-   * /brief specifies tree insertion method 
-   */
-  typedef enum 
-  {
-    insert_as_first_child,      /* insert as the first child of the node */
-    insert_as_last_child,       /* insert as the last child of the node */
-    insert_before,              /* insert before the node */
-    insert_after,               /* insert after the node */
-  } tree_insertion;
-
-  /**
-   * \brief tree node structure
-   */
-  typedef struct tree_node_ {
-    struct tree_node_*    parent;
-    struct tree_node_*    first_child;
-    struct tree_node_*    last_child;
-    struct tree_node_*    prev_sibling;
-    struct tree_node_*    next_sibling;
-    generic               data;
-  } tree_node;
-
-  /** 
-   * /brief creates a node with given data
-   */
-  extern tree_node* tree_alloc(void* data, const int tag);
-
-  /** 
-   * /brief deletes a node and its children
-   * not responsible for deallocation of data within nodes
-   */
-  extern void tree_free(tree_node* node);
-
-  /** 
-   * \brief inserts a node with given method 
-   */
-  extern void tree_insert(tree_node* location, tree_node* node, const tree_insertion method);
-
-  /*
-   * /brief inserts a data to tree with given method  
-   * creates a node with given data and inserts
-   */
-  extern tree_node* tree_insert_data(tree_node* location, void* data, const int tag, const tree_insertion method);
-
-  /** 
-   * /brief removes a node from the tree
-   */
-  extern void tree_remove(tree_node* node);
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
-#endif
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      dec 24th, 2006
+*  abstract:  type independent tree
+*/
+
+#ifndef __VISUEM_TREE_H__
+#define __VISUEM_TREE_H__
+
+#include "generic.h"
+#include "allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief specifies tree insertion method 
+   */
+  typedef enum 
+  {
+    insert_as_first_child,      /* insert as the first child of the node */
+    insert_as_last_child,       /* insert as the last child of the node */
+    insert_before,              /* insert before the node */
+    insert_after,               /* insert after the node */
+  } tree_insertion;
+
+  /**
+   * /brief specifies tree traversal order
+   */
+  typedef enum 
+  {
+    tree_pre_order,             /* node before its children */
+    tree_post_order,            /* node after its children */
+    tree_breadth_first,         /* level by level, left to right */
+  } tree_traversal;
+
+  /**
+   * \brief tree node structure
+   */
+  typedef struct tree_node_ {
+    struct tree_node_*    parent;
+    struct tree_node_*    first_child;
+    struct tree_node_*    last_child;
+    struct tree_node_*    prev_sibling;
+    struct tree_node_*    next_sibling;
+    generic               data;
+    const allocator*      allocator_;
+    int                   order;        /* pre-order position in last tree_index built over node */
+    unsigned int          version;      /* bumped when a child is inserted or removed */
+  } tree_node;
+
+  /** 
+   * /brief creates a node with given data
+   */
+  extern tree_node* tree_alloc(void* data, const int tag);
+
+  /** 
+   * /brief creates a node with given data which gets its memory from a given allocator
+   * nodes created with tree_insert_data use the allocator of the node they are inserted at.
+   * pass pool_allocator of a pool with sizeof(tree_node) elements to keep a tree in a pool.
+   */
+  extern tree_node* tree_alloc_with(const allocator* allocator_, void* data, const int tag);
+
+  /** 
+   * /brief deletes a node and its children
+   * not responsible for deallocation of data within nodes. node isn't unlinked from
+   * its parent or siblings, remove it first if it is a part of a larger tree.
+   */
+  extern void tree_free(tree_node* node);
+
+  /** 
+   * \brief inserts a node with given method 
+   * bumps version of new parent of node and tree_epoch.
+   */
+  extern void tree_insert(tree_node* location, tree_node* node, const tree_insertion method);
+
+  /*
+   * /brief inserts a data to tree with given method  
+   * creates a node with given data and inserts
+   */
+  extern tree_node* tree_insert_data(tree_node* location, void* data, const int tag, const tree_insertion method);
+
+  /** 
+   * /brief removes a node from the tree
+   * bumps version of parent of node and tree_epoch.
+   */
+  extern void tree_remove(tree_node* node);
+
+  /** 
+   * /brief number of tree_insert and tree_remove calls made so far, process wide
+   * an atomic counter shared by all trees. views built over a tree compare it to find
+   * out cheaply that nothing changed, and check versions of their nodes otherwise.
+   */
+  extern unsigned int tree_epoch();
+
+  /** 
+   * /brief callback of tree traversal, returning non zero stops traversal
+   */
+  typedef int (*tree_visitor)(void* context, tree_node* node);
+
+  /*
+   * traversal functions below only follow the links of nodes, they need no stack or
+   * queue, and never leave the subtree of given root (siblings of root are not visited).
+   */
+
+  /** 
+   * /brief node after a given one in pre-order traversal of subtree of root
+   *
+   *   for (node = root; node; node = tree_pre_order_next(root, node))
+   *
+   * /return a null pointer if node is the last one.
+   */
+  extern tree_node* tree_pre_order_next(const tree_node* root, tree_node* node);
+
+  /** 
+   * /brief first node in post-order traversal of subtree of root
+   */
+  extern tree_node* tree_post_order_first(tree_node* root);
+
+  /** 
+   * /brief node after a given one in post-order traversal of subtree of root
+   * reads nothing but node's own links, so node may be released right after.
+   * /return a null pointer if node is the last one (root itself).
+   */
+  extern tree_node* tree_post_order_next(const tree_node* root, tree_node* node);
+
+  /** 
+   * /brief node after a given one in breadth-first traversal of subtree of root
+   * depth of node below root is given and updated through depth. finding the next node
+   * of a level walks up to a common ancestor and down again, so it costs more than 
+   * depth first traversals on deep trees.
+   * /return a null pointer if node is the last one.
+   */
+  extern tree_node* tree_breadth_first_next(const tree_node* root, tree_node* node, int* depth);
+
+  /** 
+   * /brief visits nodes of subtree of root in given order
+   * /return value returned by the visitor which stopped traversal, 0 if none did.
+   */
+  extern int tree_visit(tree_node* root, const tree_traversal order, tree_visitor visitor, void* context);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
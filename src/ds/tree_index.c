@@ -0,0 +1,205 @@
+#include "tree_index.h"
+#include <memory.h> /* memset */
+
+/**
+ * largest power of two not above a count, as exponent
+ */
+int tree_index_log2(int count);
+int tree_index_log2(int count)
+{
+  int exponent = 0;
+
+  while (count >>= 1) ++exponent;
+  return exponent;
+}
+
+/**
+ * shallower of two positions
+ */
+#define tree_index_shallower(index, a, b) ((index)->depth[b] < (index)->depth[a] ? (b) : (a))
+
+/**
+ * makes room for a number of nodes in arrays of an index
+ */
+void tree_index_reserve(tree_index* index, const int capacity);
+void tree_index_reserve(tree_index* index, const int capacity)
+{
+  const allocator* allocator_ = index->allocator_;
+  int grown = index->capacity ? index->capacity : 64;
+
+  if (capacity <= index->capacity) return;
+  while (grown < capacity) grown *= 2;
+  index->nodes = (tree_node**)allocator_reallocate(allocator_, index->nodes, grown * sizeof(tree_node*));
+  index->exit = (int*)allocator_reallocate(allocator_, index->exit, grown * sizeof(int));
+  index->depth = (int*)allocator_reallocate(allocator_, index->depth, grown * sizeof(int));
+  index->versions = (unsigned int*)allocator_reallocate(allocator_, index->versions, grown * sizeof(unsigned int));
+  index->capacity = grown;
+}
+
+/**
+ * rebuilds index if tree changed since it was built. a removed node can only have been
+ * released after its parent at build time, which comes before it in pre-order, was 
+ * bumped, so the scan stops before reaching it.
+ */
+void tree_index_sync(tree_index* index);
+void tree_index_sync(tree_index* index)
+{
+  const unsigned int epoch = tree_epoch();
+  int loop;
+
+  if (!index->built) 
+  {
+    tree_index_rebuild(index);
+    return;
+  }
+  if (index->epoch == epoch) return;
+  for (loop = 0; loop < index->count; loop++)
+  {
+    if (index->nodes[loop]->version != index->versions[loop]) 
+    {
+      tree_index_rebuild(index);
+      return;
+    }
+  }
+  index->epoch = epoch;
+}
+
+tree_index* tree_index_alloc(tree_node* root)
+{
+  return tree_index_alloc_with(0, root);
+}
+
+tree_index* tree_index_alloc_with(const allocator* allocator_, tree_node* root)
+{
+  tree_index* new_index;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_index = (tree_index*)allocator_allocate(allocator_, sizeof(tree_index));
+  memset(new_index, 0, sizeof(tree_index));
+  new_index->root = root;
+  new_index->allocator_ = allocator_;
+  return new_index;
+}
+
+void tree_index_free(tree_index* index)
+{
+  const allocator* allocator_ = index->allocator_;
+
+  if (index->nodes) allocator_release(allocator_, index->nodes);
+  if (index->exit) allocator_release(allocator_, index->exit);
+  if (index->depth) allocator_release(allocator_, index->depth);
+  if (index->versions) allocator_release(allocator_, index->versions);
+  if (index->sparse) allocator_release(allocator_, index->sparse);
+  allocator_release(allocator_, index);
+}
+
+void tree_index_rebuild(tree_index* index)
+{
+  tree_node* node;
+  int* level;
+  int* below;
+  int count = 0;
+  int position;
+  int span;
+  int loop;
+
+  /* entry times and depths, parent of a node is always numbered before it */
+  for (node = index->root; node; node = tree_pre_order_next(index->root, node))
+  {
+    tree_index_reserve(index, count + 1);
+    index->nodes[count] = node;
+    index->depth[count] = node == index->root ? 0 : index->depth[node->parent->order] + 1;
+    index->exit[count] = count;
+    index->versions[count] = node->version;
+    node->order = count++;
+  }
+  index->count = count;
+
+  /* exit times, last node of a subtree is reported to the parent from the bottom up */
+  for (position = count - 1; position > 0; position--)
+  {
+    loop = index->nodes[position]->parent->order;
+    if (index->exit[position] > index->exit[loop]) index->exit[loop] = index->exit[position];
+  }
+
+  /* sparse table, level k holds shallowest position in [i, i + 2^k) */
+  index->levels = count ? tree_index_log2(count) + 1 : 0;
+  index->sparse = (int*)allocator_reallocate(index->allocator_, index->sparse, (index->levels * count + 1) * sizeof(int));
+  for (loop = 0; loop < count; loop++) index->sparse[loop] = loop;
+  for (span = 1, loop = 1; loop < index->levels; loop++, span *= 2)
+  {
+    below = index->sparse + (loop - 1) * count;
+    level = index->sparse + loop * count;
+    for (position = 0; position + 2 * span <= count; position++)
+    {
+      level[position] = tree_index_shallower(index, below[position], below[position + span]);
+    }
+  }
+
+  index->epoch = tree_epoch();
+  index->built = 1;
+}
+
+/**
+ * tests whether order field of a node still refers to its position in index
+ */
+#define tree_index_owns(index, node) ((node)->order >= 0 && (node)->order < (index)->count && (index)->nodes[(node)->order] == (node))
+
+int tree_index_position(tree_index* index, tree_node* node)
+{
+  tree_node* up;
+
+  tree_index_sync(index);
+  if (tree_index_owns(index, node)) return node->order;
+
+  /* order may have been taken by another index since, renumber if node is ours */
+  for (up = node; up && up != index->root; up = up->parent);
+  if (!up) return -1;
+  tree_index_rebuild(index);
+  return tree_index_owns(index, node) ? node->order : -1;
+}
+
+int tree_index_is_ancestor(tree_index* index, tree_node* ancestor, tree_node* node)
+{
+  const int entry = tree_index_position(index, ancestor);
+  const int position = tree_index_position(index, node);
+
+  return entry >= 0 && position >= entry && position <= index->exit[entry];
+}
+
+tree_node** tree_index_subtree(tree_index* index, tree_node* node, int* count)
+{
+  const int entry = tree_index_position(index, node);
+
+  if (entry < 0) 
+  {
+    *count = 0;
+    return 0;
+  }
+  *count = index->exit[entry] - entry + 1;
+  return index->nodes + entry;
+}
+
+tree_node* tree_index_lca(tree_index* index, tree_node* a, tree_node* b)
+{
+  int first = tree_index_position(index, a);
+  int last = tree_index_position(index, b);
+  int level;
+  int swap;
+
+  if (first < 0 || last < 0) return 0;
+  if (first > last) 
+  {
+    swap = first;
+    first = last;
+    last = swap;
+  }
+  if (last <= index->exit[first]) return index->nodes[first];
+
+  /* shallowest node after first up to last is a child of the common ancestor */
+  ++first;
+  level = tree_index_log2(last - first + 1);
+  swap = tree_index_shallower(index, index->sparse[level * index->count + first], 
+                                     index->sparse[level * index->count + last - (1 << level) + 1]);
+  return index->nodes[swap]->parent;
+}
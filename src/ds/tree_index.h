@@ -0,0 +1,124 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  euler tour index of a tree for ancestor, subtree and common ancestor queries
+*/
+
+#ifndef __VISUEM_TREE_INDEX_H__
+#define __VISUEM_TREE_INDEX_H__
+
+#include "allocator.h"
+#include "tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief euler tour index of subtree of a root
+   * every node gets its pre-order position as entry time, stored in its order field,
+   * and the position of the last node of its subtree as exit time. a node is in subtree
+   * of another if its entry time lies within entry and exit time of the other, and
+   * subtree of a node is a contiguous range of nodes. lowest common ancestors are 
+   * answered by a sparse table of the shallowest node over ranges of positions.
+   *
+   * trees should be edited through tree_insert and tree_remove, which bump version of
+   * the parent they change and tree_epoch. while tree_epoch stays the same, a query 
+   * checks nothing else. after it moves, the next query compares versions of indexed
+   * nodes with the ones recorded at build time, and rebuilds only if one of them 
+   * changed. edits in other trees or outside subtree of root cost that single check. order field of a node is owned by one 
+   * index at a time, indices over overlapping trees rebuild each other.
+   */
+  typedef struct 
+  {
+    tree_node*            root;
+    tree_node**           nodes;              /* nodes in pre-order */
+    int*                  exit;               /* position of last node in subtree */
+    int*                  depth;              /* depth below root */
+    int*                  sparse;             /* levels of shallowest node over 2^level positions */
+    unsigned int*         versions;           /* versions of nodes at build time */
+    int                   count;              /* number of nodes */
+    int                   capacity;           /* capacity of arrays */
+    int                   levels;             /* number of levels in sparse table */
+    unsigned int          epoch;              /* tree_epoch nodes were last checked at */
+    int                   built;              /* index has been built */
+    const allocator*      allocator_;         /* allocator of index and its arrays */
+  } tree_index;
+
+  /** 
+   * /brief allocates an index over subtree of root, built on first query
+   */
+  extern tree_index* tree_index_alloc(tree_node* root);
+
+  /** 
+   * /brief allocates an index over subtree of root which gets its memory from a given allocator
+   */
+  extern tree_index* tree_index_alloc_with(const allocator* allocator_, tree_node* root);
+
+  /** 
+   * /brief deletes an index. tree isn't touched.
+   */
+  extern void tree_index_free(tree_index* index);
+
+  /** 
+   * /brief rebuilds index now, eg. after links were changed without tree_insert or tree_remove
+   */
+  extern void tree_index_rebuild(tree_index* index);
+
+  /** 
+   * /brief pre-order position of a node, its entry time
+   * /return -1 if node isn't in indexed tree.
+   */
+  extern int tree_index_position(tree_index* index, tree_node* node);
+
+  /** 
+   * /brief tests whether ancestor is node itself or one of its ancestors
+   */
+  extern int tree_index_is_ancestor(tree_index* index, tree_node* ancestor, tree_node* node);
+
+  /** 
+   * /brief nodes of subtree of a node in pre-order
+   * pointer stays valid until index is rebuilt.
+   * /return pointer to node itself, count is set to number of nodes in its subtree. a 
+   *         null pointer if node isn't in indexed tree.
+   */
+  extern tree_node** tree_index_subtree(tree_index* index, tree_node* node, int* count);
+
+  /** 
+   * /brief lowest common ancestor of two nodes
+   * /return a null pointer if either node isn't in indexed tree.
+   */
+  extern tree_node* tree_index_lca(tree_index* index, tree_node* a, tree_node* b);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
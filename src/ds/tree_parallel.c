@@ -0,0 +1,416 @@
+#include "tree_parallel.h"
+#include <stdatomic.h>
+#include <memory.h> /* memset */
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h> /* sched_yield */
+#endif
+
+/**
+ * thread of a worker
+ */
+#ifdef _WIN32
+typedef HANDLE tree_parallel_thread;
+#define tree_parallel_yield() SwitchToThread()
+#else
+typedef pthread_t tree_parallel_thread;
+#define tree_parallel_yield() sched_yield()
+#endif
+
+/**
+ * node of post-order traversal waiting for its children
+ */
+typedef struct tree_parallel_join_
+{
+  tree_node*            node;
+  struct tree_parallel_join_* parent;   /* join of parent node, null for root */
+  atomic_int            pending;        /* number of children not done yet */
+} tree_parallel_join;
+
+/**
+ * queued subtree. a thief may read a slot while owner rewrites it, so fields are
+ * atomic. what a thief read is only used if it wins the slot.
+ */
+typedef struct
+{
+  _Atomic(tree_node*)   node;
+  _Atomic(tree_parallel_join*) parent;  /* join notified when subtree is done, post-order only */
+} tree_parallel_task;
+
+/**
+ * circular task buffer of a deque. outgrown buffers may still be read by thieves,
+ * so they are kept in a list until traversal ends.
+ */
+typedef struct tree_parallel_buffer_
+{
+  struct tree_parallel_buffer_* retired; /* buffer this one replaced */
+  int                   capacity;       /* power of two */
+  tree_parallel_task    tasks[1];
+} tree_parallel_buffer;
+
+/**
+ * chase-lev task deque of a worker. owner pushes and takes at the bottom without
+ * locking, thieves take from the top with a compare and swap.
+ */
+typedef struct
+{
+  atomic_int            top;
+  atomic_int            bottom;
+  _Atomic(tree_parallel_buffer*) buffer;
+  char                  padding[64];    /* keeps deques of workers off each other's cache lines */
+} tree_parallel_deque;
+
+/**
+ * state shared by workers of a traversal
+ */
+typedef struct
+{
+  tree_traversal        order;
+  tree_visitor          visitor;
+  void*                 context;
+  tree_parallel_deque*  deques;
+  int                   worker_count;
+  const allocator*      allocator_;     /* scratch memory of traversal, used from every worker */
+  atomic_int            outstanding;    /* tasks queued or being processed */
+  atomic_int            result;         /* first non zero visitor result */
+} tree_parallel;
+
+/**
+ * worker thread argument
+ */
+typedef struct
+{
+  tree_parallel*        shared;
+  int                   index;
+} tree_parallel_worker;
+
+/**
+ * creates a task buffer with given capacity
+ */
+tree_parallel_buffer* tree_parallel_buffer_create(const allocator* allocator_, const int capacity);
+tree_parallel_buffer* tree_parallel_buffer_create(const allocator* allocator_, const int capacity)
+{
+  size_t size = sizeof(tree_parallel_buffer) + (capacity - 1) * sizeof(tree_parallel_task);
+  tree_parallel_buffer* buffer = (tree_parallel_buffer*)allocator_allocate(allocator_, size);
+
+  memset(buffer, 0, size);
+  buffer->capacity = capacity;
+  return buffer;
+}
+
+/**
+ * queues a task at the bottom of own deque
+ */
+void tree_parallel_push(tree_parallel* shared, tree_parallel_deque* own, tree_node* node, tree_parallel_join* parent);
+void tree_parallel_push(tree_parallel* shared, tree_parallel_deque* own, tree_node* node, tree_parallel_join* parent)
+{
+  const int bottom = atomic_load_explicit(&own->bottom, memory_order_relaxed);
+  const int top = atomic_load_explicit(&own->top, memory_order_acquire);
+  tree_parallel_buffer* buffer = atomic_load_explicit(&own->buffer, memory_order_relaxed);
+  tree_parallel_buffer* grown;
+  tree_parallel_task* task;
+  int loop;
+
+  atomic_fetch_add_explicit(&shared->outstanding, 1, memory_order_relaxed);
+  if (bottom - top >= buffer->capacity)
+  {
+    grown = tree_parallel_buffer_create(shared->allocator_, buffer->capacity * 2);
+    for (loop = top; loop < bottom; loop++)
+    {
+      task = &buffer->tasks[loop & (buffer->capacity - 1)];
+      atomic_store_explicit(&grown->tasks[loop & (grown->capacity - 1)].node, atomic_load_explicit(&task->node, memory_order_relaxed), memory_order_relaxed);
+      atomic_store_explicit(&grown->tasks[loop & (grown->capacity - 1)].parent, atomic_load_explicit(&task->parent, memory_order_relaxed), memory_order_relaxed);
+    }
+    grown->retired = buffer;
+    atomic_store_explicit(&own->buffer, grown, memory_order_release);
+    buffer = grown;
+  }
+  task = &buffer->tasks[bottom & (buffer->capacity - 1)];
+  atomic_store_explicit(&task->node, node, memory_order_relaxed);
+  atomic_store_explicit(&task->parent, parent, memory_order_relaxed);
+  /* publishes the task to thieves which acquire bottom */
+  atomic_store_explicit(&own->bottom, bottom + 1, memory_order_release);
+}
+
+/**
+ * takes newest task of own deque, returns 0 if deque is empty
+ */
+int tree_parallel_take(tree_parallel_deque* own, tree_node** node, tree_parallel_join** parent);
+int tree_parallel_take(tree_parallel_deque* own, tree_node** node, tree_parallel_join** parent)
+{
+  const int bottom = atomic_load_explicit(&own->bottom, memory_order_relaxed) - 1;
+  tree_parallel_buffer* buffer = atomic_load_explicit(&own->buffer, memory_order_relaxed);
+  tree_parallel_task* task;
+  int top;
+  int taken = 1;
+
+  atomic_store_explicit(&own->bottom, bottom, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  top = atomic_load_explicit(&own->top, memory_order_relaxed);
+  if (top > bottom)
+  {
+    atomic_store_explicit(&own->bottom, bottom + 1, memory_order_relaxed);
+    return 0;
+  }
+  task = &buffer->tasks[bottom & (buffer->capacity - 1)];
+  *node = atomic_load_explicit(&task->node, memory_order_relaxed);
+  *parent = atomic_load_explicit(&task->parent, memory_order_relaxed);
+  if (top == bottom)
+  {
+    /* last task, race thieves for it */
+    taken = atomic_compare_exchange_strong_explicit(&own->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&own->bottom, bottom + 1, memory_order_relaxed);
+  }
+  return taken;
+}
+
+/**
+ * takes oldest task of another worker's deque, returns 0 if deque is empty or another
+ * thread won the task
+ */
+int tree_parallel_steal(tree_parallel_deque* victim, tree_node** node, tree_parallel_join** parent);
+int tree_parallel_steal(tree_parallel_deque* victim, tree_node** node, tree_parallel_join** parent)
+{
+  int top = atomic_load_explicit(&victim->top, memory_order_acquire);
+  int bottom;
+  tree_parallel_buffer* buffer;
+  tree_parallel_task* task;
+
+  atomic_thread_fence(memory_order_seq_cst);
+  bottom = atomic_load_explicit(&victim->bottom, memory_order_acquire);
+  if (top >= bottom) return 0;
+  buffer = atomic_load_explicit(&victim->buffer, memory_order_acquire);
+  task = &buffer->tasks[top & (buffer->capacity - 1)];
+  *node = atomic_load_explicit(&task->node, memory_order_relaxed);
+  *parent = atomic_load_explicit(&task->parent, memory_order_relaxed);
+  return atomic_compare_exchange_strong_explicit(&victim->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+}
+
+/**
+ * number of tasks in own deque. bottom is only written by owner, top may be a
+ * little behind, which is fine for deciding whether to split.
+ */
+#define tree_parallel_queued(own) (atomic_load_explicit(&(own)->bottom, memory_order_relaxed) - atomic_load_explicit(&(own)->top, memory_order_relaxed))
+
+/**
+ * visits a node unless traversal is stopped
+ */
+void tree_parallel_visit(tree_parallel* shared, tree_node* node);
+void tree_parallel_visit(tree_parallel* shared, tree_node* node)
+{
+  int result;
+  int expected = 0;
+
+  if (atomic_load_explicit(&shared->result, memory_order_relaxed) != 0) return;
+  if ((result = shared->visitor(shared->context, node)) != 0)
+  {
+    atomic_compare_exchange_strong(&shared->result, &expected, result);
+  }
+}
+
+/**
+ * marks a subtree done for the join of its parent. last child to finish visits the
+ * parent, which may in turn finish the join above it.
+ */
+void tree_parallel_complete(tree_parallel* shared, tree_parallel_join* join);
+void tree_parallel_complete(tree_parallel* shared, tree_parallel_join* join)
+{
+  tree_parallel_join* parent;
+
+  while (join && atomic_fetch_sub_explicit(&join->pending, 1, memory_order_acq_rel) == 1)
+  {
+    tree_parallel_visit(shared, join->node);
+    parent = join->parent;
+    allocator_release(shared->allocator_, join);
+    join = parent;
+  }
+}
+
+/**
+ * walks a subtree on the current thread
+ */
+void tree_parallel_walk(tree_parallel* shared, tree_node* root);
+void tree_parallel_walk(tree_parallel* shared, tree_node* root)
+{
+  tree_node* node;
+  tree_node* next;
+
+  if (shared->order == tree_pre_order)
+  {
+    for (node = root; node; node = tree_pre_order_next(root, node)) tree_parallel_visit(shared, node);
+  }
+  else
+  {
+    for (node = tree_post_order_first(root); node; node = next)
+    {
+      next = tree_post_order_next(root, node);
+      tree_parallel_visit(shared, node);
+    }
+  }
+}
+
+/**
+ * processes a task, splitting its subtree into child tasks while own deque is short
+ */
+void tree_parallel_process(tree_parallel* shared, tree_parallel_deque* own, tree_node* node, tree_parallel_join* parent);
+void tree_parallel_process(tree_parallel* shared, tree_parallel_deque* own, tree_node* node, tree_parallel_join* parent)
+{
+  tree_node* child;
+  tree_parallel_join* join;
+  int children = 0;
+
+  if (!node->first_child || tree_parallel_queued(own) >= TREE_PARALLEL_SPLIT_LIMIT || atomic_load_explicit(&shared->result, memory_order_relaxed) != 0)
+  {
+    tree_parallel_walk(shared, node);
+    if (shared->order == tree_post_order) tree_parallel_complete(shared, parent);
+    return;
+  }
+  if (shared->order == tree_pre_order)
+  {
+    tree_parallel_visit(shared, node);
+    /* pushed last to first, so owner continues with first child */
+    for (child = node->last_child; child; child = child->prev_sibling) tree_parallel_push(shared, own, child, 0);
+    return;
+  }
+  for (child = node->first_child; child; child = child->next_sibling) ++children;
+  join = (tree_parallel_join*)allocator_allocate(shared->allocator_, sizeof(tree_parallel_join));
+  join->node = node;
+  join->parent = parent;
+  atomic_init(&join->pending, children);
+  for (child = node->last_child; child; child = child->prev_sibling) tree_parallel_push(shared, own, child, join);
+}
+
+/**
+ * worker loop, runs until no task is left anywhere
+ */
+void tree_parallel_run(tree_parallel_worker* worker);
+void tree_parallel_run(tree_parallel_worker* worker)
+{
+  tree_parallel* shared = worker->shared;
+  tree_parallel_deque* own = &shared->deques[worker->index];
+  tree_parallel_join* parent;
+  tree_node* node;
+  int victim;
+  int found;
+
+  while (atomic_load_explicit(&shared->outstanding, memory_order_acquire) > 0)
+  {
+    found = tree_parallel_take(own, &node, &parent);
+    for (victim = 1; !found && victim < shared->worker_count; victim++)
+    {
+      found = tree_parallel_steal(&shared->deques[(worker->index + victim) % shared->worker_count], &node, &parent);
+    }
+    if (!found)
+    {
+      tree_parallel_yield();
+      continue;
+    }
+    tree_parallel_process(shared, own, node, parent);
+    atomic_fetch_sub_explicit(&shared->outstanding, 1, memory_order_acq_rel);
+  }
+}
+
+/**
+ * thread entry of a worker
+ */
+#ifdef _WIN32
+DWORD WINAPI tree_parallel_entry(LPVOID argument);
+DWORD WINAPI tree_parallel_entry(LPVOID argument)
+#else
+void* tree_parallel_entry(void* argument);
+void* tree_parallel_entry(void* argument)
+#endif
+{
+  tree_parallel_run((tree_parallel_worker*)argument);
+  return 0;
+}
+
+/**
+ * starts a worker thread, returns 0 if thread can't be created
+ */
+int tree_parallel_start(tree_parallel_thread* thread, tree_parallel_worker* worker);
+int tree_parallel_start(tree_parallel_thread* thread, tree_parallel_worker* worker)
+{
+#ifdef _WIN32
+  return (*thread = CreateThread(0, 0, tree_parallel_entry, worker, 0, 0)) != 0;
+#else
+  return pthread_create(thread, 0, tree_parallel_entry, worker) == 0;
+#endif
+}
+
+/**
+ * waits for a worker thread to finish
+ */
+void tree_parallel_wait(tree_parallel_thread thread);
+void tree_parallel_wait(tree_parallel_thread thread)
+{
+#ifdef _WIN32
+  WaitForSingleObject(thread, INFINITE);
+  CloseHandle(thread);
+#else
+  pthread_join(thread, 0);
+#endif
+}
+
+int tree_visit_parallel(tree_node* root, const tree_traversal order, tree_visitor visitor, void* context, const int thread_count)
+{
+  tree_parallel shared;
+  tree_parallel_worker* workers;
+  tree_parallel_thread* threads;
+  tree_parallel_buffer* buffer;
+  tree_parallel_buffer* retired;
+  int worker_count = thread_count > 1 ? thread_count : 1;
+  int created;
+  int loop;
+
+  /* breadth-first has no parallel counterpart, its order is the whole point of it */
+  if (order == tree_breadth_first || worker_count == 1) return tree_visit(root, order, visitor, context);
+
+  shared.order = order;
+  shared.visitor = visitor;
+  shared.context = context;
+  shared.worker_count = worker_count;
+  /* allocator of nodes may be a pool, which is neither thread safe nor fit for scratch blocks */
+  shared.allocator_ = &allocator_libc;
+  shared.deques = (tree_parallel_deque*)allocator_allocate(shared.allocator_, worker_count * sizeof(tree_parallel_deque));
+  for (loop = 0; loop < worker_count; loop++)
+  {
+    atomic_init(&shared.deques[loop].top, 0);
+    atomic_init(&shared.deques[loop].bottom, 0);
+    atomic_init(&shared.deques[loop].buffer, tree_parallel_buffer_create(shared.allocator_, 2 * TREE_PARALLEL_SPLIT_LIMIT));
+  }
+  atomic_init(&shared.outstanding, 0);
+  atomic_init(&shared.result, 0);
+  tree_parallel_push(&shared, &shared.deques[0], root, 0);
+
+  workers = (tree_parallel_worker*)allocator_allocate(shared.allocator_, worker_count * sizeof(tree_parallel_worker));
+  threads = (tree_parallel_thread*)allocator_allocate(shared.allocator_, worker_count * sizeof(tree_parallel_thread));
+  for (loop = 0; loop < worker_count; loop++)
+  {
+    workers[loop].shared = &shared;
+    workers[loop].index = loop;
+  }
+  /* calling thread is worker 0, work gets done even if no thread can be started */
+  for (created = 1; created < worker_count; created++)
+  {
+    if (!tree_parallel_start(&threads[created], &workers[created])) break;
+  }
+  tree_parallel_run(&workers[0]);
+  for (loop = 1; loop < created; loop++) tree_parallel_wait(threads[loop]);
+
+  for (loop = 0; loop < worker_count; loop++)
+  {
+    for (buffer = atomic_load_explicit(&shared.deques[loop].buffer, memory_order_relaxed); buffer; buffer = retired)
+    {
+      retired = buffer->retired;
+      allocator_release(shared.allocator_, buffer);
+    }
+  }
+  allocator_release(shared.allocator_, shared.deques);
+  allocator_release(shared.allocator_, workers);
+  allocator_release(shared.allocator_, threads);
+  return atomic_load(&shared.result);
+}
@@ -0,0 +1,72 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  parallel traversal of trees on a work stealing thread pool
+*/
+
+#ifndef __VISUEM_TREE_PARALLEL_H__
+#define __VISUEM_TREE_PARALLEL_H__
+
+#include "tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief number of queued subtrees below which a worker keeps splitting work.
+   * a worker with more queued subtrees than this walks the next subtree by itself.
+   */
+#define TREE_PARALLEL_SPLIT_LIMIT 32
+
+  /** 
+   * /brief visits nodes of subtree of root on a number of threads, calling thread included
+   * 
+   * subtrees are queued as tasks on per thread deques. a thread takes its newest task,
+   * and idle threads steal oldest tasks of others, which are subtrees near root. 
+   * supported orders are tree_pre_order, where a node is visited before any of its 
+   * children, and tree_post_order, where a node is visited after all of its children 
+   * (eg. merging bounds of children). siblings are visited in no particular order.
+   *
+   * scratch memory of traversal comes from allocator_libc, whatever the allocator of
+   * nodes is. threads are pthreads, or win32 threads on windows.
+   *
+   * visitor is called concurrently for different nodes. returning non zero from it stops
+   * the traversal as soon as possible, nodes already being visited are finished.
+   *
+   * /return a non zero value returned by visitor, 0 if none was.
+   */
+  extern int tree_visit_parallel(tree_node* root, const tree_traversal order, tree_visitor visitor, void* context, const int thread_count);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+#include "tree_snapshot.h"
+#include <memory.h> /* memset */
+#include <string.h> /* memmove */
+
+/**
+ * makes room for a number of nodes in arrays of a snapshot
+ */
+void tree_snapshot_reserve(tree_snapshot* snapshot, const int capacity);
+void tree_snapshot_reserve(tree_snapshot* snapshot, const int capacity)
+{
+  const allocator* allocator_ = snapshot->allocator_;
+  int grown = snapshot->capacity ? snapshot->capacity : 64;
+
+  if (capacity <= snapshot->capacity) return;
+  while (grown < capacity) grown *= 2;
+  snapshot->parent = (int32_t*)allocator_reallocate(allocator_, snapshot->parent, grown * sizeof(int32_t));
+  snapshot->first_child = (int32_t*)allocator_reallocate(allocator_, snapshot->first_child, grown * sizeof(int32_t));
+  snapshot->next_sibling = (int32_t*)allocator_reallocate(allocator_, snapshot->next_sibling, grown * sizeof(int32_t));
+  snapshot->subtree_size = (int32_t*)allocator_reallocate(allocator_, snapshot->subtree_size, grown * sizeof(int32_t));
+  snapshot->data = (generic*)allocator_reallocate(allocator_, snapshot->data, grown * sizeof(generic));
+  snapshot->nodes = (tree_node**)allocator_reallocate(allocator_, snapshot->nodes, grown * sizeof(tree_node*));
+  snapshot->capacity = grown;
+}
+
+/**
+ * number of nodes in subtree of root
+ */
+int tree_count(tree_node* root);
+int tree_count(tree_node* root)
+{
+  tree_node* node;
+  int count = 0;
+
+  for (node = root; node; node = tree_pre_order_next(root, node)) ++count;
+  return count;
+}
+
+/**
+ * writes subtree of root into snapshot in pre-order starting at an index. arrays must 
+ * have room for it. root is given parent index and no next sibling.
+ */
+void tree_snapshot_write(tree_snapshot* snapshot, tree_node* root, const int index, const int parent);
+void tree_snapshot_write(tree_snapshot* snapshot, tree_node* root, const int index, const int parent)
+{
+  tree_node* node = root;
+  int next = index;
+  int current;
+
+  /* parent of every other node is set as soon as its position is known */
+  snapshot->parent[index] = parent;
+  for (;;)
+  {
+    current = next++;
+    snapshot->first_child[current] = -1;
+    snapshot->next_sibling[current] = -1;
+    snapshot->data[current] = node->data;
+    snapshot->nodes[current] = node;
+    if (node->first_child) 
+    {
+      snapshot->first_child[current] = next;
+      snapshot->parent[next] = current;
+      node = node->first_child;
+      continue;
+    }
+    /* subtrees are complete on the way up */
+    for (;;)
+    {
+      snapshot->subtree_size[current] = next - current;
+      if (node == root) return;
+      if (node->next_sibling) 
+      {
+        snapshot->next_sibling[current] = next;
+        snapshot->parent[next] = snapshot->parent[current];
+        node = node->next_sibling;
+        break;
+      }
+      node = node->parent;
+      current = snapshot->parent[current];
+    }
+  }
+}
+
+tree_snapshot* tree_snapshot_alloc()
+{
+  return tree_snapshot_alloc_with(0);
+}
+
+tree_snapshot* tree_snapshot_alloc_with(const allocator* allocator_)
+{
+  tree_snapshot* new_snapshot;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_snapshot = (tree_snapshot*)allocator_allocate(allocator_, sizeof(tree_snapshot));
+  memset(new_snapshot, 0, sizeof(tree_snapshot));
+  new_snapshot->allocator_ = allocator_;
+  return new_snapshot;
+}
+
+void tree_snapshot_free(tree_snapshot* snapshot)
+{
+  if (snapshot->capacity) 
+  {
+    allocator_release(snapshot->allocator_, snapshot->parent);
+    allocator_release(snapshot->allocator_, snapshot->first_child);
+    allocator_release(snapshot->allocator_, snapshot->next_sibling);
+    allocator_release(snapshot->allocator_, snapshot->subtree_size);
+    allocator_release(snapshot->allocator_, snapshot->data);
+    allocator_release(snapshot->allocator_, snapshot->nodes);
+  }
+  allocator_release(snapshot->allocator_, snapshot);
+}
+
+int tree_flatten(tree_snapshot* snapshot, tree_node* root)
+{
+  snapshot->count = tree_count(root);
+  tree_snapshot_reserve(snapshot, snapshot->count);
+  tree_snapshot_write(snapshot, root, 0, -1);
+  return snapshot->count;
+}
+
+int tree_reflatten(tree_snapshot* snapshot, const int index)
+{
+  tree_node* root = snapshot->nodes[index];
+  const int old_size = snapshot->subtree_size[index];
+  const int old_end = index + old_size;
+  const int new_size = tree_count(root);
+  const int delta = new_size - old_size;
+  int32_t next_sibling = snapshot->next_sibling[index];
+  int loop;
+
+  if (delta != 0) 
+  {
+    /* links into the part after the subtree move with it */
+    for (loop = 0; loop < snapshot->count; loop++) 
+    {
+      if (loop == index) loop = old_end;
+      if (loop == snapshot->count) break;
+      if (snapshot->parent[loop] >= old_end) snapshot->parent[loop] += delta;
+      if (snapshot->first_child[loop] >= old_end) snapshot->first_child[loop] += delta;
+      if (snapshot->next_sibling[loop] >= old_end) snapshot->next_sibling[loop] += delta;
+    }
+    for (loop = snapshot->parent[index]; loop >= 0; loop = snapshot->parent[loop]) 
+    {
+      snapshot->subtree_size[loop] += delta;
+    }
+    if (next_sibling >= 0) next_sibling += delta;
+
+    tree_snapshot_reserve(snapshot, snapshot->count + delta);
+    memmove(snapshot->parent + old_end + delta, snapshot->parent + old_end, (snapshot->count - old_end) * sizeof(int32_t));
+    memmove(snapshot->first_child + old_end + delta, snapshot->first_child + old_end, (snapshot->count - old_end) * sizeof(int32_t));
+    memmove(snapshot->next_sibling + old_end + delta, snapshot->next_sibling + old_end, (snapshot->count - old_end) * sizeof(int32_t));
+    memmove(snapshot->subtree_size + old_end + delta, snapshot->subtree_size + old_end, (snapshot->count - old_end) * sizeof(int32_t));
+    memmove(snapshot->data + old_end + delta, snapshot->data + old_end, (snapshot->count - old_end) * sizeof(generic));
+    memmove(snapshot->nodes + old_end + delta, snapshot->nodes + old_end, (snapshot->count - old_end) * sizeof(tree_node*));
+    snapshot->count += delta;
+  }
+  tree_snapshot_write(snapshot, root, index, snapshot->parent[index]);
+  snapshot->next_sibling[index] = next_sibling;
+  return new_size;
+}
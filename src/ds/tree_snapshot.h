@@ -0,0 +1,104 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  flat, depth-first ordered snapshot of a tree
+*/
+
+#ifndef __VISUEM_TREE_SNAPSHOT_H__
+#define __VISUEM_TREE_SNAPSHOT_H__
+
+#include <stdint.h> /* int32_t */
+#include "generic.h"
+#include "allocator.h"
+#include "tree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** 
+   * /brief structure of arrays snapshot of a tree
+   * nodes are numbered in pre-order, so subtree of node i is the range 
+   * [i, i + subtree_size[i]) and a full walk is a sequential scan. eg. visiting
+   * everything except subtrees of hidden nodes:
+   *
+   *   for (i = 0; i < snapshot->count; i += visible ? 1 : snapshot->subtree_size[i])
+   *
+   * links are indices, -1 where there is no such node. data holds a copy of the 
+   * payload of every node and nodes the node it was taken from.
+   */
+  typedef struct 
+  {
+    int32_t*              parent;
+    int32_t*              first_child;
+    int32_t*              next_sibling;
+    int32_t*              subtree_size;       /* number of nodes in subtree, node included */
+    generic*              data;               /* payloads */
+    tree_node**           nodes;              /* source nodes */
+    int                   count;              /* number of nodes */
+    int                   capacity;           /* capacity of arrays */
+    const allocator*      allocator_;         /* allocator of snapshot and its arrays */
+  } tree_snapshot;
+
+  /** 
+   * /brief allocates an empty snapshot
+   */
+  extern tree_snapshot* tree_snapshot_alloc();
+
+  /** 
+   * /brief allocates an empty snapshot which gets its memory from a given allocator
+   */
+  extern tree_snapshot* tree_snapshot_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes a snapshot. tree it was taken from isn't touched.
+   */
+  extern void tree_snapshot_free(tree_snapshot* snapshot);
+
+  /** 
+   * /brief replaces contents of a snapshot with subtree of root
+   * /return number of nodes in snapshot.
+   */
+  extern int tree_flatten(tree_snapshot* snapshot, tree_node* root);
+
+  /** 
+   * /brief takes subtree of node at an index again, after nodes below it have been
+   * inserted, removed, reordered or changed their data. node itself must still have the
+   * same parent and siblings. rest of the snapshot is shifted and renumbered in a single
+   * sequential pass instead of walking the whole tree.
+   * /return new number of nodes in subtree.
+   */
+  extern int tree_reflatten(tree_snapshot* snapshot, const int index);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -0,0 +1,179 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  typed, value storing dynamic array generator
+*/
+
+#ifndef __VISUEM_TYPED_ARRAY_H__
+#define __VISUEM_TYPED_ARRAY_H__
+
+#include "allocator.h"
+#include <stdlib.h> /* NULL */
+#include <memory.h> /* memset */
+#include <string.h> /* memmove */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief declares a dynamic array type which stores elements of given type by value.
+   *
+   * elements are kept contiguously in a single block, so iterating over the array is a 
+   * linear memory sweep. put this into a header and ARRAY_DEFINE with the same arguments
+   * into exactly one source file. eg.
+   *
+   *   ARRAY_DECLARE(vec3_array, vector3)
+   *
+   * declares vec3_array type and vec3_array_alloc, vec3_array_alloc_with, vec3_array_free, vec3_array_push, 
+   * vec3_array_pop, vec3_array_insert, vec3_array_remove, vec3_array_reserve and
+   * vec3_array_reset functions which behave the same as their array_* counterparts.
+   * pointers returned by push and pop are invalidated by the next growth of the array.
+   */
+#define ARRAY_DECLARE(name, type) \
+  typedef struct \
+  { \
+    type*     elements;    /* elements of array */ \
+    int       capacity;    /* current capacity of array */ \
+    int       usage;       /* current usage of array */ \
+    const allocator* allocator_;  /* allocator of array and its elements */ \
+  } name; \
+  extern name* name##_alloc(); \
+  extern name* name##_alloc_with(const allocator* allocator_); \
+  extern void name##_free(name* array_); \
+  extern type* name##_push(name* array_, const type value); \
+  extern type* name##_pop(name* array_); \
+  extern void name##_insert(name* array_, const int index, const type value); \
+  extern void name##_remove(name* array_, const int index); \
+  extern void name##_reserve(name* array_, const int capacity); \
+  extern void name##_reset(name* array_);
+
+  /**
+   * /brief defines the functions of an array type declared with ARRAY_DECLARE.
+   */
+#define ARRAY_DEFINE(name, type) \
+  name* name##_alloc() \
+  { \
+    return name##_alloc_with(0); \
+  } \
+  \
+  name* name##_alloc_with(const allocator* allocator_) \
+  { \
+    name* new_array; \
+    \
+    allocator_ = allocator_resolve(allocator_); \
+    new_array = (name*)allocator_allocate(allocator_, sizeof(name)); \
+    memset(new_array, 0, sizeof(name)); \
+    new_array->allocator_ = allocator_; \
+    return new_array; \
+  } \
+  \
+  void name##_free(name* array_) \
+  { \
+    if (array_->elements) \
+    { \
+      allocator_release(array_->allocator_, array_->elements); \
+    } \
+    allocator_release(array_->allocator_, array_); \
+  } \
+  \
+  void name##_reserve(name* array_, const int capacity) \
+  { \
+    if (capacity > array_->capacity) \
+    { \
+      array_->capacity = capacity; \
+      array_->elements = (type*)allocator_reallocate(array_->allocator_, array_->elements, array_->capacity * sizeof(type)); \
+    } \
+  } \
+  \
+  type* name##_push(name* array_, const type value) \
+  { \
+    const int index = array_->usage; \
+    \
+    if (index >= array_->capacity) \
+    { \
+      name##_reserve(array_, array_->capacity + (array_->capacity ? array_->capacity : 8)); \
+    } \
+    array_->elements[index] = value; \
+    ++(array_->usage); \
+    return &array_->elements[index]; \
+  } \
+  \
+  type* name##_pop(name* array_) \
+  { \
+    if (array_->usage > 0) \
+    { \
+      return &array_->elements[--(array_->usage)]; \
+    } \
+    return NULL; \
+  } \
+  \
+  void name##_insert(name* array_, const int index, const type value) \
+  { \
+    if (index >= array_->usage) \
+    { \
+      name##_push(array_, value); \
+      return; \
+    } \
+    if (array_->usage >= array_->capacity) \
+    { \
+      name##_reserve(array_, array_->capacity + (array_->capacity ? array_->capacity : 8)); \
+    } \
+    memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(type)); \
+    array_->elements[index] = value; \
+    ++(array_->usage); \
+  } \
+  \
+  void name##_remove(name* array_, const int index) \
+  { \
+    if (index >= array_->usage - 1) \
+    { \
+      name##_pop(array_); \
+      return; \
+    } \
+    memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index - 1) * sizeof(type)); \
+    --(array_->usage); \
+  } \
+  \
+  void name##_reset(name* array_) \
+  { \
+    if (array_->elements) \
+    { \
+      allocator_release(array_->allocator_, array_->elements); \
+      array_->elements = 0; \
+      array_->usage = 0; \
+      array_->capacity = 0; \
+    } \
+  }
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -1,83 +1,176 @@
-#include "array.h"
-#include <stdlib.h> /* malloc */
-#include <memory.h> /* memset */
-#include <string.h> /* memmove */
-
-array* array_alloc()
-{
-  array* new_array = (array*)malloc(sizeof(array));
-  memset(new_array, 0, sizeof(array));
-  return new_array;
-}
-
-void array_free(array* array_)
-{
-  if (array_->elements)
-  {
-    free(array_->elements);
-  }
-  free(array_);
-}
-
-generic* array_push(array* array_, void* data, const int tag) {
-  const int index = array_->usage;
-
-  if (index >= array_->capacity)
-  {
-    array_->capacity += array_->capacity ? array_->capacity : 8;
-    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));                                                                          
-  }
-  array_->elements[index].pointer = data;
-  array_->elements[index].tag = tag;
-  ++(array_->usage);
-  return &array_->elements[index];
-}
-
-generic* array_pop(array* array_)
-{ 
-  if (array_->usage > 0)
-  {
-    return &array_->elements[(array_->usage)--];
-  }
-  return NULL;
-}
-
-void array_insert(array* array_, const int index, void* data, const int tag) 
-{
-  if (index >= array_->usage)
-  {
-    array_push(array_, data, tag);
-    return;
-  }
-  if (array_->usage >= array_->capacity)
-  {
-    array_->capacity += array_->capacity?array_->capacity:8;
-    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));
-  }
-  memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(generic));
-  array_->elements[index].pointer = data;
-  array_->elements[index].tag = tag;
-  ++(array_->usage);
-}
-
-extern void array_remove(array* array_, const int index) 
-{
-  if (index >= array_->usage)
-  {
-    array_pop(array_);
-    return;
-  }
-  memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index) * sizeof(generic));                  
-  --(array_->usage);
-}
-
-extern void array_reset(array* array_)
-{
-  if (array_->elements) 
-  {
-    free(array_->elements);
-    array_->elements = 0;
-    array_->usage = 0;
-    array_->capacity = 0;
-  }
-}
+#include "array.h"
+#include <stdlib.h> /* malloc */
+#include <memory.h> /* memset */
+#include <string.h> /* memmove */
+
+array* array_alloc()
+{
+  array* new_array = (array*)malloc(sizeof(array));
+  memset(new_array, 0, sizeof(array));
+  return new_array;
+}
+
+void array_free(array* array_)
+{
+  if (array_->elements)
+  {
+    free(array_->elements);
+  }
+  free(array_);
+}
+
+generic* array_push(array* array_, void* data, const int tag) {
+  const int index = array_->usage;
+
+  if (index >= array_->capacity)
+  {
+    array_->capacity += array_->capacity ? array_->capacity : 8;
+    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));                                                                          
+  }
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+  return &array_->elements[index];
+}
+
+generic* array_pop(array* array_)
+{ 
+  if (array_->usage > 0)
+  {
+    return &array_->elements[--(array_->usage)];
+  }
+  return NULL;
+}
+
+void array_insert(array* array_, const int index, void* data, const int tag) 
+{
+  if (index >= array_->usage)
+  {
+    array_push(array_, data, tag);
+    return;
+  }
+  if (array_->usage >= array_->capacity)
+  {
+    array_->capacity += array_->capacity?array_->capacity:8;
+    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));
+  }
+  memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(generic));
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+}
+
+extern void array_remove(array* array_, const int index) 
+{
+  if (index >= array_->usage - 1)
+  {
+    array_pop(array_);
+    return;
+  }
+  memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index - 1) * sizeof(generic));                  
+  --(array_->usage);
+}
+
+extern void array_reset(array* array_)
+{
+  if (array_->elements) 
+  {
+    free(array_->elements);
+    array_->elements = 0;
+    array_->usage = 0;
+    array_->capacity = 0;
+  }
+}
+
+/**
+ * grows a small array, moving its elements to the heap when they leave inline storage.
+ */
+void small_array_grow(small_array* array_);
+void small_array_grow(small_array* array_)
+{
+  generic* elements;
+
+  array_->capacity += array_->capacity;
+  if (array_->elements == array_->inline_elements)
+  {
+    elements = (generic*)malloc(array_->capacity * sizeof(generic));
+    memcpy(elements, array_->inline_elements, array_->usage * sizeof(generic));
+    array_->elements = elements;
+  }
+  else
+  {
+    array_->elements = (generic*)realloc(array_->elements, array_->capacity * sizeof(generic));
+  }
+}
+
+void small_array_init(small_array* array_)
+{
+  array_->elements = array_->inline_elements;
+  array_->capacity = SMALL_ARRAY_INLINE_CAPACITY;
+  array_->usage = 0;
+}
+
+void small_array_release(small_array* array_)
+{
+  if (array_->elements != array_->inline_elements)
+  {
+    free(array_->elements);
+  }
+  small_array_init(array_);
+}
+
+generic* small_array_push(small_array* array_, void* data, const int tag)
+{
+  const int index = array_->usage;
+
+  if (index >= array_->capacity)
+  {
+    small_array_grow(array_);
+  }
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+  return &array_->elements[index];
+}
+
+generic* small_array_pop(small_array* array_)
+{ 
+  if (array_->usage > 0)
+  {
+    return &array_->elements[--(array_->usage)];
+  }
+  return NULL;
+}
+
+void small_array_insert(small_array* array_, const int index, void* data, const int tag) 
+{
+  if (index >= array_->usage)
+  {
+    small_array_push(array_, data, tag);
+    return;
+  }
+  if (array_->usage >= array_->capacity)
+  {
+    small_array_grow(array_);
+  }
+  memmove(array_->elements + index + 1, array_->elements + index, (array_->usage - index) * sizeof(generic));
+  array_->elements[index].pointer = data;
+  array_->elements[index].tag = tag;
+  ++(array_->usage);
+}
+
+void small_array_remove(small_array* array_, const int index) 
+{
+  if (index >= array_->usage - 1)
+  {
+    small_array_pop(array_);
+    return;
+  }
+  memmove(array_->elements + index, array_->elements + index + 1, (array_->usage - index - 1) * sizeof(generic));                  
+  --(array_->usage);
+}
+
+void small_array_reset(small_array* array_)
+{
+  small_array_release(array_);
+}
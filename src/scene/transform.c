@@ -0,0 +1,185 @@
+#include "transform.h"
+#include <memory.h> /* memset */
+
+ARRAY_DEFINE(transform_batch, matrix4_product)
+
+/**
+ * transform of a hierarchy node
+ */
+#define transform_of(n) ((transform*)(n)->data.pointer)
+
+/**
+ * frees transforms of a subtree, nodes are left to tree_free
+ */
+int transform_release(void* context, tree_node* node);
+int transform_release(void* context, tree_node* node)
+{
+  allocator_release(((transform_hierarchy*)context)->allocator_, transform_of(node));
+  return 0;
+}
+
+/**
+ * batch of a depth, created when hierarchy gets that deep for the first time
+ */
+transform_batch* transform_hierarchy_batch(transform_hierarchy* hierarchy, const int depth);
+transform_batch* transform_hierarchy_batch(transform_hierarchy* hierarchy, const int depth)
+{
+  int loop;
+
+  if (depth >= hierarchy->batch_count) 
+  {
+    hierarchy->batches = (transform_batch**)allocator_reallocate(hierarchy->allocator_, hierarchy->batches, (depth + 1) * sizeof(transform_batch*));
+    for (loop = hierarchy->batch_count; loop <= depth; loop++) 
+    {
+      hierarchy->batches[loop] = transform_batch_alloc_with(hierarchy->allocator_);
+    }
+    hierarchy->batch_count = depth + 1;
+  }
+  return hierarchy->batches[depth];
+}
+
+transform_hierarchy* transform_hierarchy_alloc()
+{
+  return transform_hierarchy_alloc_with(0);
+}
+
+transform_hierarchy* transform_hierarchy_alloc_with(const allocator* allocator_)
+{
+  transform_hierarchy* new_hierarchy;
+
+  allocator_ = allocator_resolve(allocator_);
+  new_hierarchy = (transform_hierarchy*)allocator_allocate(allocator_, sizeof(transform_hierarchy));
+  memset(new_hierarchy, 0, sizeof(transform_hierarchy));
+  new_hierarchy->allocator_ = allocator_;
+  matrix4_identity(&new_hierarchy->origin.local);
+  matrix4_identity(&new_hierarchy->origin.world);
+  new_hierarchy->root = tree_alloc_with(allocator_, &new_hierarchy->origin, 0);
+  new_hierarchy->origin.node = new_hierarchy->root;
+  return new_hierarchy;
+}
+
+void transform_hierarchy_free(transform_hierarchy* hierarchy)
+{
+  tree_node* node;
+  int loop;
+
+  for (node = hierarchy->root->first_child; node; node = node->next_sibling) 
+  {
+    tree_visit(node, tree_post_order, transform_release, hierarchy);
+  }
+  tree_free(hierarchy->root);
+  for (loop = 0; loop < hierarchy->batch_count; loop++) transform_batch_free(hierarchy->batches[loop]);
+  if (hierarchy->batches) allocator_release(hierarchy->allocator_, hierarchy->batches);
+  allocator_release(hierarchy->allocator_, hierarchy);
+}
+
+transform* transform_create(transform_hierarchy* hierarchy, transform* parent)
+{
+  transform* new_transform = (transform*)allocator_allocate(hierarchy->allocator_, sizeof(transform));
+
+  matrix4_identity(&new_transform->local);
+  matrix4_identity(&new_transform->world);
+  new_transform->flags = 0;
+  new_transform->node = tree_insert_data(parent ? parent->node : hierarchy->root, new_transform, 0, insert_as_last_child);
+  transform_mark_dirty(hierarchy, new_transform);
+  return new_transform;
+}
+
+void transform_destroy(transform_hierarchy* hierarchy, transform* transform_)
+{
+  tree_node* node = transform_->node;
+
+  /* flags of ancestors may stay set, which only costs a visit on next update */
+  tree_remove(node);
+  tree_visit(node, tree_post_order, transform_release, hierarchy);
+  tree_free(node);
+}
+
+int transform_set_parent(transform_hierarchy* hierarchy, transform* transform_, transform* parent)
+{
+  tree_node* node;
+
+  for (node = parent ? parent->node : 0; node; node = node->parent) 
+  {
+    if (node == transform_->node) return 0;
+  }
+  tree_remove(transform_->node);
+  tree_insert(parent ? parent->node : hierarchy->root, transform_->node, insert_as_last_child);
+  transform_mark_dirty(hierarchy, transform_);
+  return 1;
+}
+
+void transform_set_local(transform_hierarchy* hierarchy, transform* transform_, const matrix4* local)
+{
+  matrix4_copy(&transform_->local, local);
+  transform_mark_dirty(hierarchy, transform_);
+}
+
+void transform_mark_dirty(transform_hierarchy* hierarchy, transform* transform_)
+{
+  tree_node* node;
+
+  (void)hierarchy;
+  transform_->flags |= TRANSFORM_DIRTY;
+  /* ancestors above one which is already marked are marked as well */
+  for (node = transform_->node->parent; node && !(transform_of(node)->flags & TRANSFORM_DIRTY_BELOW); node = node->parent) 
+  {
+    transform_of(node)->flags |= TRANSFORM_DIRTY_BELOW;
+  }
+}
+
+int transform_hierarchy_update(transform_hierarchy* hierarchy)
+{
+  tree_node* root = hierarchy->root;
+  tree_node* node;
+  transform* current;
+  matrix4_product product;
+  int depth = 0;
+  int forced = -1;      /* depth of the dirty transform whose subtree is being collected, -1 if none */
+  int count = 0;
+  int loop;
+
+  if (!(hierarchy->origin.flags & TRANSFORM_DIRTY_BELOW)) return 0;
+  hierarchy->origin.flags = 0;
+
+  /* collect products, entering only subtrees with changes */
+  node = root->first_child;
+  while (node) 
+  {
+    current = transform_of(node);
+    if (forced < 0 && (current->flags & TRANSFORM_DIRTY)) forced = depth;
+    if (forced >= 0) 
+    {
+      product.target = &current->world;
+      product.matrix = &transform_of(node->parent)->world;
+      product.other = &current->local;
+      transform_batch_push(transform_hierarchy_batch(hierarchy, depth), product);
+    }
+    if ((forced >= 0 || (current->flags & TRANSFORM_DIRTY_BELOW)) && node->first_child) 
+    {
+      current->flags = 0;
+      node = node->first_child;
+      ++depth;
+      continue;
+    }
+    current->flags = 0;
+    while (node != root && !node->next_sibling) 
+    {
+      node = node->parent;
+      --depth;
+    }
+    if (node == root) break;
+    node = node->next_sibling;
+    /* left subtree of the dirty transform */
+    if (depth <= forced) forced = -1;
+  }
+
+  /* parents before children */
+  for (loop = 0; loop < hierarchy->batch_count; loop++) 
+  {
+    matrix4_mul_batch(hierarchy->batches[loop]->elements, hierarchy->batches[loop]->usage);
+    count += hierarchy->batches[loop]->usage;
+    hierarchy->batches[loop]->usage = 0;
+  }
+  return count;
+}
@@ -0,0 +1,141 @@
+/*
+
+  The MIT License (MIT)
+
+  Copyright (c) 2015 VISUEM LTD
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+/*
+*  author:    noyan gunday
+*  date:      oct 17th, 2026
+*  abstract:  transform hierarchy with dirty tracking
+*/
+
+#ifndef __VISUEM_TRANSFORM_H__
+#define __VISUEM_TRANSFORM_H__
+
+#include "../ds/allocator.h"
+#include "../ds/tree.h"
+#include "../ds/typed_array.h"
+#include "../linear/matrix4.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /**
+   * /brief transform flags
+   */
+#define TRANSFORM_DIRTY         1   /* local matrix changed, world matrices of subtree are stale */
+#define TRANSFORM_DIRTY_BELOW   2   /* some transform below is dirty */
+
+  /** 
+   * /brief transform of a scene node
+   * world = parent world * local, computed as matrix4_mul(world, parent world, local).
+   * matrices act on column vectors, so local is applied first, in the frame of parent.
+   */
+  typedef struct 
+  {
+    matrix4               local;
+    matrix4               world;
+    int                   flags;
+    tree_node*            node;         /* node of transform in hierarchy, data of node points back */
+  } transform;
+
+  /**
+   * /brief products of a single depth of hierarchy
+   */
+  ARRAY_DECLARE(transform_batch, matrix4_product)
+
+  /** 
+   * /brief transform hierarchy
+   * transforms are kept in a tree. changing a local matrix marks the transform dirty
+   * and its ancestors as having a dirty descendant, so an update only enters subtrees 
+   * which contain changes. dirty transforms and their subtrees are collected into one
+   * batch per depth, and batches are multiplied in depth order, so parents are always
+   * done before their children. an update of a scene where nothing moved only checks 
+   * the root.
+   */
+  typedef struct 
+  {
+    transform             origin;       /* identity root, parent of top level transforms */
+    tree_node*            root;         /* node of origin */
+    transform_batch**     batches;      /* batch of each depth */
+    int                   batch_count;
+    const allocator*      allocator_;   /* allocator of hierarchy, its nodes and transforms */
+  } transform_hierarchy;
+
+  /** 
+   * /brief allocates an empty transform hierarchy
+   */
+  extern transform_hierarchy* transform_hierarchy_alloc();
+
+  /** 
+   * /brief allocates an empty transform hierarchy which gets its memory from a given allocator
+   */
+  extern transform_hierarchy* transform_hierarchy_alloc_with(const allocator* allocator_);
+
+  /** 
+   * /brief deletes a transform hierarchy with all of its transforms
+   */
+  extern void transform_hierarchy_free(transform_hierarchy* hierarchy);
+
+  /** 
+   * /brief creates an identity transform as the last child of a parent
+   * parent is a null pointer for top level transforms.
+   */
+  extern transform* transform_create(transform_hierarchy* hierarchy, transform* parent);
+
+  /** 
+   * /brief deletes a transform with all transforms below it
+   */
+  extern void transform_destroy(transform_hierarchy* hierarchy, transform* transform_);
+
+  /** 
+   * /brief moves a transform with its subtree under another parent, null for top level
+   * /return 1 if transform is moved, 0 if parent is the transform itself or one of its
+   *         descendants, which would cut the subtree off the hierarchy.
+   */
+  extern int transform_set_parent(transform_hierarchy* hierarchy, transform* transform_, transform* parent);
+
+  /** 
+   * /brief sets local matrix of a transform
+   */
+  extern void transform_set_local(transform_hierarchy* hierarchy, transform* transform_, const matrix4* local);
+
+  /** 
+   * /brief marks a transform dirty after its local matrix is modified in place
+   */
+  extern void transform_mark_dirty(transform_hierarchy* hierarchy, transform* transform_);
+
+  /** 
+   * /brief recomputes world matrices of dirty transforms and their subtrees
+   * /return number of world matrices recomputed.
+   */
+  extern int transform_hierarchy_update(transform_hierarchy* hierarchy);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif